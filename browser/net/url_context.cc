@@ -17,15 +17,20 @@
 
 namespace brave {
 
-namespace {
+BraveRequestInfo::BraveRequestInfo() = default;
 
-std::string GetUploadData(const network::ResourceRequest& request) {
-  std::string upload_data;
-  if (!request.request_body) {
+BraveRequestInfo::BraveRequestInfo(const GURL& url) : request_url(url) {}
+
+BraveRequestInfo::~BraveRequestInfo() = default;
+
+std::string BraveRequestInfo::GetUploadData() {
+  if (!request_body) {
     return {};
   }
-  const auto* elements = request.request_body->elements();
-  for (const network::DataElement& element : *elements) {
+
+  upload_data_copies_++;
+  std::string upload_data;
+  for (const network::DataElement& element : *request_body->elements()) {
     if (element.type() == network::mojom::DataElementType::kBytes) {
       upload_data.append(element.bytes(), element.length());
     }
@@ -34,14 +39,6 @@ std::string GetUploadData(const network::ResourceRequest& request) {
   return upload_data;
 }
 
-}  // namespace
-
-BraveRequestInfo::BraveRequestInfo() = default;
-
-BraveRequestInfo::BraveRequestInfo(const GURL& url) : request_url(url) {}
-
-BraveRequestInfo::~BraveRequestInfo() = default;
-
 // static
 void BraveRequestInfo::FillCTX(const network::ResourceRequest& request,
                                int render_process_id,
@@ -101,7 +98,7 @@ void BraveRequestInfo::FillCTX(const network::ResourceRequest& request,
       !brave_shields::GetHTTPSEverywhereEnabled(profile, ctx->tab_origin);
   ctx->allow_referrers =
       brave_shields::AllowReferrers(profile, ctx->tab_origin);
-  ctx->upload_data = GetUploadData(request);
+  ctx->request_body = request.request_body;
 }
 
 }  // namespace brave
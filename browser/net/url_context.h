@@ -12,6 +12,7 @@
 
 #include "content/public/common/resource_type.h"
 #include "net/url_request/url_request.h"
+#include "services/network/public/cpp/resource_request_body.h"
 #include "url/gurl.h"
 
 class BraveRequestHandler;
@@ -100,7 +101,17 @@ struct BraveRequestInfo {
       static_cast<content::ResourceType>(-1);
   content::ResourceType resource_type = kInvalidResourceType;
 
-  std::string upload_data;
+  // Shares the body elements with the request. Nothing is copied until a
+  // helper asks for the bytes with GetUploadData().
+  scoped_refptr<network::ResourceRequestBody> request_body;
+
+  // Concatenates the in-memory elements of |request_body|. This copies the
+  // whole body, so only call it once the request is known to be of interest.
+  std::string GetUploadData();
+
+  size_t upload_data_copies_for_testing() const {
+    return upload_data_copies_;
+  }
 
   static void FillCTX(const network::ResourceRequest& request,
                       int render_process_id,
@@ -116,6 +127,8 @@ struct BraveRequestInfo {
 
   GURL* new_url = nullptr;
 
+  size_t upload_data_copies_ = 0;
+
   DISALLOW_COPY_AND_ASSIGN(BraveRequestInfo);
 };
 
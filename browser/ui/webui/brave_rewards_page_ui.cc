@@ -77,9 +77,10 @@ class RewardsDOMHandler : public WebUIMessageHandler,
   void GetReconcileStamp(const base::ListValue* args);
   void SaveSetting(const base::ListValue* args);
   void UpdateAdsRewards(const base::ListValue* args);
-  void OnContentSiteList(
-      std::unique_ptr<brave_rewards::ContentSiteList>,
-      uint32_t record);
+  void OnContentSitePage(
+      uint32_t generation,
+      bool first_page,
+      std::unique_ptr<brave_rewards::ContentSitePage> page);
   void OnExcludedSiteList(
       std::unique_ptr<brave_rewards::ContentSiteList>,
       uint32_t record);
@@ -92,6 +93,7 @@ class RewardsDOMHandler : public WebUIMessageHandler,
   void GetRecurringTips(const base::ListValue* args);
   void GetOneTimeTips(const base::ListValue* args);
   void GetContributionList(const base::ListValue* args);
+  void GetContributionListPage(const base::ListValue* args);
   void CheckImported(const base::ListValue* args);
   void GetAdsData(const base::ListValue* args);
   void GetAdsHistory(const base::ListValue* args);
@@ -286,6 +288,10 @@ class RewardsDOMHandler : public WebUIMessageHandler,
 
   brave_rewards::RewardsService* rewards_service_;  // NOT OWNED
   brave_ads::AdsService* ads_service_;
+  // Filter of the contribution list pages which are being shown
+  std::unique_ptr<brave_rewards::AutoContributeProps> contribute_list_props_;
+  // Bumped on every first page, so pages of an older list are dropped
+  uint32_t contribute_list_generation_;
   base::WeakPtrFactory<RewardsDOMHandler> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(RewardsDOMHandler);
@@ -298,9 +304,13 @@ const char kShouldAllowAdConversionTracking[] =
 
 const int kDaysOfAdsHistory = 7;
 
+const uint32_t kContributionListPageSize = 50;
+
 }  // namespace
 
-RewardsDOMHandler::RewardsDOMHandler() : weak_factory_(this) {}
+RewardsDOMHandler::RewardsDOMHandler()
+    : contribute_list_generation_(0),
+      weak_factory_(this) {}
 
 RewardsDOMHandler::~RewardsDOMHandler() {
   if (rewards_service_)
@@ -374,6 +384,9 @@ void RewardsDOMHandler::RegisterMessages() {
   web_ui()->RegisterMessageCallback("brave_rewards.getContributionList",
       base::BindRepeating(&RewardsDOMHandler::GetContributionList,
       base::Unretained(this)));
+  web_ui()->RegisterMessageCallback("brave_rewards.getContributionListPage",
+      base::BindRepeating(&RewardsDOMHandler::GetContributionListPage,
+      base::Unretained(this)));
   web_ui()->RegisterMessageCallback("brave_rewards.checkImported",
       base::BindRepeating(&RewardsDOMHandler::CheckImported,
       base::Unretained(this)));
@@ -739,16 +752,20 @@ void RewardsDOMHandler::GetReconcileStamp(const base::ListValue* args) {
 
 void RewardsDOMHandler::OnAutoContributePropsReady(
     std::unique_ptr<brave_rewards::AutoContributeProps> props) {
-  rewards_service_->GetContentSiteList(
-      0,
-      0,
-      props->contribution_min_time,
-      props->reconcile_stamp,
-      props->contribution_non_verified,
-      props->contribution_min_visits,
-      false,
-      base::Bind(&RewardsDOMHandler::OnContentSiteList,
-                 weak_factory_.GetWeakPtr()));
+  contribute_list_props_ = std::move(props);
+  contribute_list_generation_++;
+
+  rewards_service_->GetContentSitePage(
+      brave_rewards::ContentSiteCursor(),
+      kContributionListPageSize,
+      contribute_list_props_->contribution_min_time,
+      contribute_list_props_->reconcile_stamp,
+      contribute_list_props_->contribution_non_verified,
+      contribute_list_props_->contribution_min_visits,
+      base::BindOnce(&RewardsDOMHandler::OnContentSitePage,
+                     weak_factory_.GetWeakPtr(),
+                     contribute_list_generation_,
+                     true));
 }
 
 void RewardsDOMHandler::OnAutoContributePropsReadyExcluded(
@@ -898,12 +915,17 @@ void RewardsDOMHandler::RestorePublisher(const base::ListValue *args) {
   rewards_service_->SetPublisherExclude(publisherKey, false);
 }
 
-void RewardsDOMHandler::OnContentSiteList(
-    std::unique_ptr<brave_rewards::ContentSiteList> list,
-    uint32_t record) {
+void RewardsDOMHandler::OnContentSitePage(
+    uint32_t generation,
+    bool first_page,
+    std::unique_ptr<brave_rewards::ContentSitePage> page) {
+  if (generation != contribute_list_generation_) {
+    return;
+  }
+
   if (web_ui()->CanCallJavascript()) {
     auto publishers = std::make_unique<base::ListValue>();
-    for (auto const& item : *list) {
+    for (auto const& item : page->list) {
       auto publisher = std::make_unique<base::DictionaryValue>();
       publisher->SetString("id", item.id);
       publisher->SetDouble("percentage", item.percentage);
@@ -917,8 +939,20 @@ void RewardsDOMHandler::OnContentSiteList(
       publishers->Append(std::move(publisher));
     }
 
+    base::DictionaryValue data;
+    data.SetList("list", std::move(publishers));
+    data.SetInteger("total", page->total);
+    data.SetBoolean("firstPage", first_page);
+
+    if (!page->next.id.empty()) {
+      auto next = std::make_unique<base::DictionaryValue>();
+      next->SetInteger("percentage", page->next.percentage);
+      next->SetString("publisherKey", page->next.id);
+      data.SetDictionary("next", std::move(next));
+    }
+
     web_ui()->CallJavascriptFunctionUnsafe(
-        "brave_rewards.contributeList", *publishers);
+        "brave_rewards.contributeList", data);
   }
 }
 
@@ -1071,6 +1105,35 @@ void RewardsDOMHandler::GetContributionList(const base::ListValue *args) {
   }
 }
 
+void RewardsDOMHandler::GetContributionListPage(const base::ListValue *args) {
+  CHECK_EQ(2U, args->GetSize());
+  if (!rewards_service_) {
+    return;
+  }
+
+  // Pages are only valid for the filter of the first page
+  if (!contribute_list_props_) {
+    OnContentSiteUpdated(rewards_service_);
+    return;
+  }
+
+  brave_rewards::ContentSiteCursor cursor;
+  cursor.percentage = args->GetList()[0].GetInt();
+  cursor.id = args->GetList()[1].GetString();
+
+  rewards_service_->GetContentSitePage(
+      cursor,
+      kContributionListPageSize,
+      contribute_list_props_->contribution_min_time,
+      contribute_list_props_->reconcile_stamp,
+      contribute_list_props_->contribution_non_verified,
+      contribute_list_props_->contribution_min_visits,
+      base::BindOnce(&RewardsDOMHandler::OnContentSitePage,
+                     weak_factory_.GetWeakPtr(),
+                     contribute_list_generation_,
+                     false));
+}
+
 void RewardsDOMHandler::CheckImported(const base::ListValue *args) {
   if (web_ui()->CanCallJavascript() && rewards_service_) {
     bool imported = rewards_service_->CheckImported();
@@ -1364,7 +1427,8 @@ void RewardsDOMHandler::OnRewardsMainEnabled(
 void RewardsDOMHandler::OnPublisherListNormalized(
     brave_rewards::RewardsService* rewards_service,
     const brave_rewards::ContentSiteList& list) {
-  OnContentSiteList(std::make_unique<brave_rewards::ContentSiteList>(list), 0);
+  // Percentages have changed, so the page cursors the UI holds are stale
+  OnContentSiteUpdated(rewards_service);
 }
 
 void RewardsDOMHandler::GetTransactionHistory(
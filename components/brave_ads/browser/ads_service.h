@@ -26,6 +26,9 @@ class ListValue;
 
 namespace brave_ads {
 
+using OnShouldClassifyPageCallback =
+    base::OnceCallback<void(bool)>;
+
 using OnGetAdsHistoryCallback =
     base::OnceCallback<void(const base::ListValue&)>;
 
@@ -67,6 +70,9 @@ class AdsService : public KeyedService {
   virtual void ChangeLocale(
       const std::string& locale) = 0;
 
+  virtual void ShouldClassifyPage(
+      const std::string& url,
+      OnShouldClassifyPageCallback callback) = 0;
   virtual void OnPageLoaded(
       const std::string& url,
       const std::string& html) = 0;
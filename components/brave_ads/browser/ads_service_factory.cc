@@ -19,7 +19,6 @@
 
 #if BUILDFLAG(BRAVE_ADS_ENABLED)
 #include "brave/components/brave_ads/browser/ads_service_impl.h"
-#include "chrome/browser/dom_distiller/dom_distiller_service_factory.h"
 #include "chrome/browser/notifications/notification_display_service_factory.h"
 #include "brave/components/brave_rewards/browser/rewards_service_factory.h"
 #endif
@@ -46,7 +45,6 @@ AdsServiceFactory::AdsServiceFactory()
           BrowserContextDependencyManager::GetInstance()) {
 #if BUILDFLAG(BRAVE_ADS_ENABLED)
   DependsOn(NotificationDisplayServiceFactory::GetInstance());
-  DependsOn(dom_distiller::DomDistillerServiceFactory::GetInstance());
   DependsOn(brave_rewards::RewardsServiceFactory::GetInstance());
 #endif
 }
@@ -60,7 +60,6 @@
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "services/network/public/cpp/simple_url_loader.h"
 #include "services/service_manager/public/cpp/connector.h"
-#include "third_party/dom_distiller_js/dom_distiller.pb.h"
 #include "ui/base/l10n/l10n_util.h"
 #include "ui/base/resource/resource_bundle.h"
 #include "ui/message_center/public/cpp/notification.h"
@@ -278,6 +277,15 @@ bool SaveBundleStateOnFileTaskRunner(
   return false;
 }
 
+void MaybeVacuumBundleStateOnFileTaskRunner(
+    BundleStateDatabase* backend) {
+  if (!backend) {
+    return;
+  }
+
+  backend->MaybeVacuum();
+}
+
 net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
   return net::DefineNetworkTrafficAnnotation("ads_service_impl", R"(
       semantics {
@@ -408,6 +416,25 @@ void AdsServiceImpl::ChangeLocale(
   bat_ads_->ChangeLocale(locale);
 }
 
+void AdsServiceImpl::ShouldClassifyPage(
+    const std::string& url,
+    OnShouldClassifyPageCallback callback) {
+  if (!connected()) {
+    std::move(callback).Run(false);
+    return;
+  }
+
+  bat_ads_->ShouldClassifyPage(url,
+      base::BindOnce(&AdsServiceImpl::OnShouldClassifyPage, AsWeakPtr(),
+          std::move(callback)));
+}
+
+void AdsServiceImpl::OnShouldClassifyPage(
+    OnShouldClassifyPageCallback callback,
+    const bool should_classify) {
+  std::move(callback).Run(should_classify);
+}
+
 void AdsServiceImpl::OnPageLoaded(
     const std::string& url,
     const std::string& html) {
@@ -802,6 +829,12 @@ void AdsServiceImpl::ProcessIdleState(
     bat_ads_->OnUnIdle();
   } else {
     bat_ads_->OnIdle();
+
+    // Bundle state is saved differentially so the database is only vacuumed
+    // while the user is idle rather than on every catalog update
+    file_task_runner_->PostTask(FROM_HERE,
+        base::BindOnce(&MaybeVacuumBundleStateOnFileTaskRunner,
+            bundle_state_backend_.get()));
   }
 
   last_idle_state_ = idle_state;
@@ -81,6 +81,9 @@ class AdsServiceImpl : public AdsService,
   void ChangeLocale(
       const std::string& locale) override;
 
+  void ShouldClassifyPage(
+      const std::string& url,
+      OnShouldClassifyPageCallback callback) override;
   void OnPageLoaded(
       const std::string& url,
       const std::string& html) override;
@@ -227,6 +230,10 @@ class AdsServiceImpl : public AdsService,
       const std::string& url,
       const std::vector<ads::AdConversionTrackingInfo>& ad_conversions);
 
+  void OnShouldClassifyPage(
+      OnShouldClassifyPageCallback callback,
+      const bool should_classify);
+
   void OnGetAdsHistory(
       OnGetAdsHistoryCallback callback,
       const std::string& json);
@@ -45,6 +45,14 @@ class MockRewardsService : public RewardsService {
            uint32_t,
            bool,
            const brave_rewards::GetContentSiteListCallback&));
+  MOCK_METHOD7(GetContentSitePage,
+      void(const brave_rewards::ContentSiteCursor&,
+           uint32_t,
+           uint64_t,
+           uint64_t,
+           bool,
+           uint32_t,
+           brave_rewards::GetContentSitePageCallback));
   MOCK_METHOD0(FetchPromotions, void());
   MOCK_METHOD1(ClaimPromotion, void(brave_rewards::ClaimPromotionCallback));
   MOCK_METHOD2(ClaimPromotion, void(const std::string&,
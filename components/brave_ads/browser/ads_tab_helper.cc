@@ -8,14 +8,13 @@
 #include <memory>
 #include <utility>
 
+#include "base/strings/utf_string_conversions.h"
+#include "base/values.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
 #include "brave/components/brave_ads/browser/ads_service_factory.h"
-#include "chrome/browser/dom_distiller/dom_distiller_service_factory.h"
 #include "chrome/browser/profiles/profile.h"
 #include "chrome/browser/sessions/session_tab_helper.h"
-#include "components/dom_distiller/content/browser/distiller_page_web_contents.h"
-#include "components/dom_distiller/core/distiller_page.h"
-#include "components/dom_distiller/core/dom_distiller_service.h"
+#include "chrome/common/chrome_isolated_world_ids.h"
 #include "content/public/browser/navigation_handle.h"
 #include "content/public/browser/render_frame_host.h"
 #include "content/public/browser/web_contents.h"
@@ -29,13 +28,62 @@
 
 namespace brave_ads {
 
+namespace {
+
+// Samples the text of the page for classification. Text within elements which
+// do not describe the content of the page is skipped, and the walk stops as
+// soon as enough words have been sampled so large pages are not read in full
+const char kExtractPageTextScript[] = R"(
+  (function() {
+    const kMaximumWords = 1000;
+
+    const kSkippedElements = new Set([
+      'NAV', 'SCRIPT', 'STYLE', 'NOSCRIPT', 'TEMPLATE', 'IFRAME', 'SVG'
+    ]);
+
+    if (!document.body) {
+      return '';
+    }
+
+    const walker = document.createTreeWalker(document.body,
+        NodeFilter.SHOW_ELEMENT | NodeFilter.SHOW_TEXT, {
+      acceptNode: (node) => {
+        if (node.nodeType !== Node.ELEMENT_NODE) {
+          return NodeFilter.FILTER_ACCEPT;
+        }
+
+        return kSkippedElements.has(node.nodeName.toUpperCase()) ?
+            NodeFilter.FILTER_REJECT : NodeFilter.FILTER_SKIP;
+      }
+    });
+
+    const words = [];
+    while (words.length < kMaximumWords && walker.nextNode()) {
+      for (const word of walker.currentNode.nodeValue.split(/\s+/)) {
+        if (!word) {
+          continue;
+        }
+
+        words.push(word);
+        if (words.length === kMaximumWords) {
+          break;
+        }
+      }
+    }
+
+    return words.join(' ');
+  })();
+)";
+
+}  // namespace
+
 AdsTabHelper::AdsTabHelper(content::WebContents* web_contents)
     : WebContentsObserver(web_contents),
       tab_id_(SessionTabHelper::IdForTab(web_contents)),
       ads_service_(nullptr),
       is_active_(false),
       is_browser_active_(true),
-      run_distiller_(false),
+      should_extract_page_text_(false),
       weak_factory_(this) {
   if (!tab_id_.is_valid())
     return;
@@ -57,73 +105,75 @@ AdsTabHelper::~AdsTabHelper() {
 #endif
 }
 
+// static
+std::string AdsTabHelper::GetExtractPageTextScript() {
+  return kExtractPageTextScript;
+}
+
 void AdsTabHelper::DidFinishNavigation(
     content::NavigationHandle* navigation_handle) {
   if (navigation_handle->IsInMainFrame() &&
       navigation_handle->GetResponseHeaders()) {
     if (navigation_handle->GetResponseHeaders()->HasHeaderValue(
             "cache-control", "no-store")) {
-      run_distiller_ = false;
+      should_extract_page_text_ = false;
     } else {
       bool was_restored =
           navigation_handle->GetRestoreType() != content::RestoreType::NONE;
-      run_distiller_ = !was_restored;
+      should_extract_page_text_ = !was_restored;
     }
   }
 }
 
 void AdsTabHelper::DocumentOnLoadCompletedInMainFrame() {
-  // don't start distilling is the ad service isn't enabled
-  if (!ads_service_ || !ads_service_->IsEnabled() || !run_distiller_)
+  // don't extract the page text if the ad service isn't enabled
+  if (!ads_service_ || !ads_service_->IsEnabled() ||
+      !should_extract_page_text_)
     return;
 
-  auto* dom_distiller_service =
-      dom_distiller::DomDistillerServiceFactory::GetForBrowserContext(
-          web_contents()->GetBrowserContext());
-
-  if (!dom_distiller_service)
-    return;
+  const GURL& url = web_contents()->GetLastCommittedURL();
 
-  auto source_page_handle =
-      std::make_unique<dom_distiller::SourcePageHandleWebContents>(
-          web_contents(), false);
+  // The page text is only extracted if the page is classified and its page
+  // score is not already cached
+  ads_service_->ShouldClassifyPage(url.spec(),
+      base::BindOnce(&AdsTabHelper::OnShouldClassifyPage,
+          weak_factory_.GetWeakPtr(), url));
+}
 
-  auto distiller_page =
-      dom_distiller_service->CreateDefaultDistillerPageWithHandle(
-          std::move(source_page_handle));
+void AdsTabHelper::OnShouldClassifyPage(
+    const GURL& url,
+    bool should_classify) {
+  if (!ads_service_)
+    return;
 
-  auto options = dom_distiller::proto::DomDistillerOptions();
-  // options.set_extract_text_only(true);
-  // options.set_debug_level(1);
+  if (!should_classify) {
+    ads_service_->OnPageLoaded(url.spec(), "");
+    return;
+  }
 
-  auto* distiller_page_ptr = distiller_page.get();
+  // The user may have navigated away while waiting for the ads service
+  if (web_contents()->GetLastCommittedURL() != url)
+    return;
 
-  distiller_page_ptr->DistillPage(
-      web_contents()->GetLastCommittedURL(),
-      options,
-      base::Bind(&AdsTabHelper::OnWebContentsDistillationDone,
-          weak_factory_.GetWeakPtr(),
-          web_contents()->GetLastCommittedURL(),
-          base::Passed(std::move(distiller_page))));
+  web_contents()->GetMainFrame()->ExecuteJavaScriptInIsolatedWorld(
+      base::UTF8ToUTF16(GetExtractPageTextScript()),
+      base::BindOnce(&AdsTabHelper::OnPageTextExtracted,
+          weak_factory_.GetWeakPtr(), url),
+      ISOLATED_WORLD_ID_CHROME_INTERNAL);
 }
 
-void AdsTabHelper::OnWebContentsDistillationDone(
+void AdsTabHelper::OnPageTextExtracted(
     const GURL& url,
-    std::unique_ptr<dom_distiller::DistillerPage> distiller_page,
-    std::unique_ptr<dom_distiller::proto::DomDistillerResult> distiller_result,
-    bool distillation_successful) {
-  if (!ads_service_ )
+    base::Value value) {
+  if (!ads_service_)
     return;
 
-  if (distillation_successful &&
-      distiller_result->has_distilled_content() &&
-      distiller_result->has_markup_info() &&
-      distiller_result->distilled_content().has_html()) {
-    ads_service_->OnPageLoaded(url.spec(),
-                               distiller_result->distilled_content().html());
-  } else {
-    // TODO(bridiver) - fall back to web_contents()->GenerateMHTML or ignore?
-  }
+  // Tokenizing and classifying the text happens in the ads service process
+  // rather than on the UI thread
+  if (!value.is_string())
+    return;
+
+  ads_service_->OnPageLoaded(url.spec(), value.GetString());
 }
 
 void AdsTabHelper::DidFinishLoad(
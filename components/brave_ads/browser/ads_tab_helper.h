@@ -20,15 +20,9 @@
 
 class Browser;
 
-namespace dom_distiller {
-
-class DistillerPage;
-
-namespace proto {
-class DomDistillerResult;
-}  // namespace proto
-
-}  // namespace dom_distiller
+namespace base {
+class Value;
+}  // namespace base
 
 namespace brave_ads {
 
@@ -43,6 +37,9 @@ class AdsTabHelper : public content::WebContentsObserver,
   AdsTabHelper(content::WebContents*);
   ~AdsTabHelper() override;
 
+  // Returns the script which samples the text of a page for classification
+  static std::string GetExtractPageTextScript();
+
  private:
   friend class content::WebContentsUserData<AdsTabHelper>;
 
@@ -70,17 +67,18 @@ class AdsTabHelper : public content::WebContentsObserver,
   void OnBrowserNoLongerActive(Browser* browser) override;
 #endif
 
-  void OnWebContentsDistillationDone(
+  void OnShouldClassifyPage(
+      const GURL& url,
+      bool should_classify);
+  void OnPageTextExtracted(
       const GURL& url,
-      std::unique_ptr<dom_distiller::DistillerPage>,
-      std::unique_ptr<dom_distiller::proto::DomDistillerResult> result,
-      bool distillation_successful);
+      base::Value value);
 
   SessionID tab_id_;
   AdsService* ads_service_;  // NOT OWNED
   bool is_active_;
   bool is_browser_active_;
-  bool run_distiller_;
+  bool should_extract_page_text_;
 
   base::WeakPtrFactory<AdsTabHelper> weak_factory_;
   WEB_CONTENTS_USER_DATA_KEY_DECL();
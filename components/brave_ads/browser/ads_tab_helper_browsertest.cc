@@ -0,0 +1,94 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/path_service.h"
+#include "base/strings/string_util.h"
+#include "base/threading/thread_restrictions.h"
+#include "brave/components/brave_ads/browser/ads_tab_helper.h"
+#include "chrome/browser/ui/browser.h"
+#include "chrome/browser/ui/tabs/tab_strip_model.h"
+#include "chrome/common/chrome_isolated_world_ids.h"
+#include "chrome/test/base/in_process_browser_test.h"
+#include "chrome/test/base/ui_test_utils.h"
+#include "content/public/browser/web_contents.h"
+#include "content/public/test/browser_test_utils.h"
+#include "net/test/embedded_test_server/embedded_test_server.h"
+
+// npm run test -- brave_browser_tests --filter=BraveAdsTabHelperBrowserTest.*
+
+namespace {
+
+const char kTestDataDirectory[] = "brave/vendor/bat-native-ads/test/data";
+
+}  // namespace
+
+class BraveAdsTabHelperBrowserTest : public InProcessBrowserTest {
+ public:
+  void SetUpOnMainThread() override {
+    InProcessBrowserTest::SetUpOnMainThread();
+
+    embedded_test_server()->ServeFilesFromSourceDirectory(kTestDataDirectory);
+    ASSERT_TRUE(embedded_test_server()->Start());
+  }
+
+  std::string LoadTestData(
+      const std::string& name) {
+    base::ScopedAllowBlockingForTesting allow_blocking;
+
+    base::FilePath path;
+    base::PathService::Get(base::DIR_SOURCE_ROOT, &path);
+    path = path.AppendASCII(kTestDataDirectory).AppendASCII(name);
+
+    std::string value;
+    EXPECT_TRUE(base::ReadFileToString(path, &value));
+    return value;
+  }
+
+  content::WebContents* contents() {
+    return browser()->tab_strip_model()->GetActiveWebContents();
+  }
+};
+
+// The ads unit tests check that the sampled text of this page classifies the
+// same as the full page, so this keeps the script and fixture in step
+IN_PROC_BROWSER_TEST_F(BraveAdsTabHelperBrowserTest, SamplesPageText) {
+  // Arrange
+  ui_test_utils::NavigateToURL(browser(),
+      embedded_test_server()->GetURL("/page_classification.html"));
+
+  // Act
+  const std::string text = content::EvalJs(contents(),
+      brave_ads::AdsTabHelper::GetExtractPageTextScript(),
+      content::EXECUTE_SCRIPT_DEFAULT_OPTIONS,
+      ISOLATED_WORLD_ID_CHROME_INTERNAL).ExtractString();
+
+  // Assert
+  const std::string sampled_text =
+      LoadTestData("page_classification_sampled_text.txt");
+  std::string expected_text;
+  base::TrimWhitespaceASCII(sampled_text, base::TRIM_ALL, &expected_text);
+  EXPECT_EQ(expected_text, text);
+}
+
+IN_PROC_BROWSER_TEST_F(BraveAdsTabHelperBrowserTest,
+    SamplesNoPageTextWithoutBody) {
+  // Arrange
+  ui_test_utils::NavigateToURL(browser(), GURL("about:blank"));
+  ASSERT_TRUE(content::ExecJs(contents(),
+      "document.documentElement.removeChild(document.body)"));
+
+  // Act
+  const std::string text = content::EvalJs(contents(),
+      brave_ads::AdsTabHelper::GetExtractPageTextScript(),
+      content::EXECUTE_SCRIPT_DEFAULT_OPTIONS,
+      ISOLATED_WORLD_ID_CHROME_INTERNAL).ExtractString();
+
+  // Assert
+  EXPECT_TRUE(text.empty());
+}
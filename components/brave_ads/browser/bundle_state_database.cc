@@ -8,11 +8,16 @@
 #include <stdint.h>
 
 #include <map>
+#include <set>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "base/bind.h"
 #include "base/files/file_util.h"
+#include "base/strings/stringprintf.h"
+#include "base/time/time.h"
 #include "build/build_config.h"
 #include "sql/meta_table.h"
 #include "sql/statement.h"
@@ -25,11 +30,45 @@ namespace {
 const int kCurrentVersionNumber = 3;
 const int kCompatibleVersionNumber = 3;
 
+// Region and creative instance id
+using AdInfoKey = std::pair<std::string, std::string>;
+
+// Creative instance id and category
+using AdInfoCategoryKey = std::pair<std::string, std::string>;
+
+// Creative set id, type, URL pattern and observation window
+using AdConversionKey = std::tuple<std::string, std::string, std::string, int>;
+
+const char kCatalogIdKey[] = "catalog_id";
+const char kCatalogVersionKey[] = "catalog_version";
+
+// Vacuuming rewrites the whole database file so is only worthwhile once a
+// significant proportion of pages are unused
+const double kVacuumFreelistRatio = 0.25;
+
+// Formats |time| as local time the same as |strftime('%Y-%m-%d %H:%M',
+// datetime('now','localtime'))|
+std::string GetLocalTimestamp(
+    const base::Time& time) {
+  base::Time::Exploded exploded;
+  time.LocalExplode(&exploded);
+
+  return base::StringPrintf("%04d-%02d-%02d %02d:%02d", exploded.year,
+      exploded.month, exploded.day_of_month, exploded.hour, exploded.minute);
+}
+
+AdConversionKey GetAdConversionKey(
+    const ads::AdConversionTrackingInfo& ad_conversion) {
+  return AdConversionKey(ad_conversion.creative_set_id, ad_conversion.type,
+      ad_conversion.url_pattern, ad_conversion.observation_window);
+}
+
 }  // namespace
 
 BundleStateDatabase::BundleStateDatabase(const base::FilePath& db_path) :
     db_path_(db_path),
-    initialized_(false) {
+    initialized_(false),
+    is_ads_index_loaded_(false) {
   DETACH_FROM_SEQUENCE(sequence_checker_);
 }
 
@@ -46,6 +85,8 @@ bool BundleStateDatabase::Init() {
 
   initialized_ = false;
 
+  ResetAdsIndex();
+
   if (db_.is_open()) {
     db_.Close();
     meta_table_.Reset();
@@ -98,20 +139,6 @@ bool BundleStateDatabase::CreateCategoryTable() {
   return GetDB().Execute(sql.c_str());
 }
 
-bool BundleStateDatabase::TruncateCategoryTable() {
-  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-
-  bool initialized = Init();
-  DCHECK(initialized);
-
-  if (!initialized)
-    return false;
-
-  sql::Statement sql(
-      GetDB().GetCachedStatement(SQL_FROM_HERE, "DELETE FROM category"));
-  return sql.Run();
-}
-
 bool BundleStateDatabase::CreateConversionsTable() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
@@ -133,21 +160,6 @@ bool BundleStateDatabase::CreateConversionsTable() {
   return GetDB().Execute(sql.c_str());
 }
 
-bool BundleStateDatabase::TruncateConversionsTable() {
-  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-
-  const bool initialized = Init();
-  DCHECK(initialized);
-
-  if (!initialized) {
-    return false;
-  }
-
-  sql::Statement sql(GetDB().GetCachedStatement(SQL_FROM_HERE,
-      "DELETE FROM ad_conversions"));
-  return sql.Run();
-}
-
 bool BundleStateDatabase::CreateAdInfoTable() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
@@ -177,20 +189,6 @@ bool BundleStateDatabase::CreateAdInfoTable() {
   return GetDB().Execute(sql.c_str());
 }
 
-bool BundleStateDatabase::TruncateAdInfoTable() {
-  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-
-  bool initialized = Init();
-  DCHECK(initialized);
-
-  if (!initialized)
-    return false;
-
-  sql::Statement sql(
-      GetDB().GetCachedStatement(SQL_FROM_HERE, "DELETE FROM ad_info"));
-  return sql.Run();
-}
-
 bool BundleStateDatabase::CreateAdInfoCategoryTable() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
@@ -217,20 +215,6 @@ bool BundleStateDatabase::CreateAdInfoCategoryTable() {
   return GetDB().Execute(sql.c_str());
 }
 
-bool BundleStateDatabase::TruncateAdInfoCategoryTable() {
-  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-
-  bool initialized = Init();
-  DCHECK(initialized);
-
-  if (!initialized)
-    return false;
-
-  sql::Statement sql(GetDB().GetCachedStatement(SQL_FROM_HERE,
-      "DELETE FROM ad_info_category"));
-  return sql.Run();
-}
-
 bool BundleStateDatabase::CreateAdInfoCategoryNameIndex() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
@@ -249,50 +233,331 @@ bool BundleStateDatabase::SaveBundleState(
   if (!initialized)
     return false;
 
+  // Catalogs are immutable for a given id and version so there is nothing to
+  // write if this catalog was already saved
+  if (IsCatalogSaved(bundle_state))
+    return true;
+
+  ResetAdsIndex();
+
   if (!GetDB().BeginTransaction())
     return false;
 
-  // we are completely replacing here so first truncate all the tables
-  if (!TruncateAdInfoCategoryTable() ||
-      !TruncateAdInfoTable() ||
-      !TruncateCategoryTable() ||
-      !TruncateConversionsTable()) {
+  // Only rows which were added, changed or removed since the last catalog are
+  // written so a catalog refresh does not rewrite the whole database
+  if (!UpdateCategories(bundle_state) ||
+      !UpdateAdInfo(bundle_state) ||
+      !UpdateAdInfoCategories(bundle_state) ||
+      !UpdateAdConversions(bundle_state) ||
+      !SetCatalog(bundle_state)) {
     GetDB().RollbackTransaction();
     return false;
   }
 
-  auto categories = bundle_state.categories;
-  for (auto it = categories.begin(); it != categories.end(); ++it) {
-    auto category = it->first;
+  return GetDB().CommitTransaction();
+}
+
+bool BundleStateDatabase::IsCatalogSaved(
+    const ads::BundleState& bundle_state) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (bundle_state.catalog_id.empty())
+    return false;
+
+  std::string catalog_id;
+  int64_t catalog_version;
+  if (!GetMetaTable().GetValue(kCatalogIdKey, &catalog_id) ||
+      !GetMetaTable().GetValue(kCatalogVersionKey, &catalog_version)) {
+    return false;
+  }
+
+  return catalog_id == bundle_state.catalog_id &&
+      static_cast<uint64_t>(catalog_version) == bundle_state.catalog_version;
+}
+
+bool BundleStateDatabase::SetCatalog(
+    const ads::BundleState& bundle_state) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  return GetMetaTable().SetValue(kCatalogIdKey, bundle_state.catalog_id) &&
+      GetMetaTable().SetValue(kCatalogVersionKey,
+          static_cast<int64_t>(bundle_state.catalog_version));
+}
+
+bool BundleStateDatabase::UpdateCategories(
+    const ads::BundleState& bundle_state) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  std::set<std::string> categories;
+  for (const auto& category : bundle_state.categories) {
+    categories.insert(category.first);
+  }
+
+  std::vector<std::string> removed_categories;
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "SELECT name FROM category"));
+
+  while (statement.Step()) {
+    const std::string category = statement.ColumnString(0);
+    if (categories.erase(category) == 0) {
+      removed_categories.push_back(category);
+    }
+  }
+
+  for (const auto& category : removed_categories) {
+    if (!DeleteCategory(category)) {
+      return false;
+    }
+  }
+
+  // |categories| now only contains categories which were added
+  for (const auto& category : categories) {
     if (!InsertOrUpdateCategory(category)) {
-      GetDB().RollbackTransaction();
       return false;
     }
+  }
+
+  return true;
+}
+
+bool BundleStateDatabase::UpdateAdInfo(
+    const ads::BundleState& bundle_state) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  // Keyed by region and creative instance id, matching the primary key
+  std::map<AdInfoKey, ads::AdInfo> ads;
+  for (const auto& category : bundle_state.categories) {
+    for (const auto& ad_info : category.second) {
+      for (const auto& region : ad_info.regions) {
+        ads[AdInfoKey(region, ad_info.uuid)] = ad_info;
+      }
+    }
+  }
+
+  std::set<AdInfoKey> existing_ads;
+  std::vector<AdInfoKey> removed_ads;
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "SELECT region, uuid FROM ad_info"));
+
+  while (statement.Step()) {
+    const AdInfoKey key(statement.ColumnString(0), statement.ColumnString(1));
+    if (ads.find(key) == ads.end()) {
+      removed_ads.push_back(key);
+      continue;
+    }
+
+    existing_ads.insert(key);
+  }
+
+  for (const auto& key : removed_ads) {
+    if (!DeleteAdInfo(key.first, key.second)) {
+      return false;
+    }
+  }
+
+  for (const auto& ad : ads) {
+    const std::string& region = ad.first.first;
 
-    auto ads = it->second;
-    for (auto it = ads.begin(); it != ads.end(); ++it) {
-      auto ad_info = *it;
-      if (!InsertOrUpdateAdInfo(ad_info) ||
-          !InsertOrUpdateAdInfoCategory(ad_info, category)) {
-        GetDB().RollbackTransaction();
+    if (existing_ads.find(ad.first) != existing_ads.end()) {
+      if (!UpdateAdInfoIfChanged(ad.second, region)) {
         return false;
       }
+
+      continue;
+    }
+
+    if (!InsertOrUpdateAdInfo(ad.second, region)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool BundleStateDatabase::UpdateAdInfoCategories(
+    const ads::BundleState& bundle_state) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  // Keyed by creative instance id and category
+  std::set<AdInfoCategoryKey> ad_info_categories;
+  for (const auto& category : bundle_state.categories) {
+    for (const auto& ad_info : category.second) {
+      ad_info_categories.insert(AdInfoCategoryKey(ad_info.uuid,
+          category.first));
     }
   }
 
+  std::vector<AdInfoCategoryKey> removed_ad_info_categories;
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "SELECT ad_info_uuid, category_name FROM ad_info_category"));
+
+  while (statement.Step()) {
+    const AdInfoCategoryKey key(statement.ColumnString(0),
+        statement.ColumnString(1));
+    if (ad_info_categories.erase(key) == 0) {
+      removed_ad_info_categories.push_back(key);
+    }
+  }
+
+  for (const auto& key : removed_ad_info_categories) {
+    if (!DeleteAdInfoCategory(key.first, key.second)) {
+      return false;
+    }
+  }
+
+  // |ad_info_categories| now only contains rows which were added
+  for (const auto& key : ad_info_categories) {
+    if (!InsertOrUpdateAdInfoCategory(key.first, key.second)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool BundleStateDatabase::UpdateAdConversions(
+    const ads::BundleState& bundle_state) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  // Ad conversions do not have a natural key so the whole row is the key. A
+  // multiset is used as the catalog may contain duplicate ad conversions
+  std::multiset<AdConversionKey> ad_conversions;
   for (const auto& ad_conversion : bundle_state.ad_conversions) {
-    if (!InsertOrUpdateAdConversion(ad_conversion)) {
-        GetDB().RollbackTransaction();
-        return false;
+    ad_conversions.insert(GetAdConversionKey(ad_conversion));
+  }
+
+  std::vector<int64_t> removed_ad_conversion_ids;
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "SELECT id, creative_set_id, type, url_pattern, observation_window "
+      "FROM ad_conversions"));
+
+  while (statement.Step()) {
+    const AdConversionKey key(statement.ColumnString(1),
+        statement.ColumnString(2), statement.ColumnString(3),
+        statement.ColumnInt(4));
+
+    auto it = ad_conversions.find(key);
+    if (it == ad_conversions.end()) {
+      removed_ad_conversion_ids.push_back(statement.ColumnInt64(0));
+      continue;
     }
+
+    ad_conversions.erase(it);
   }
 
-  if (GetDB().CommitTransaction()) {
-    Vacuum();
-    return true;
+  for (const auto id : removed_ad_conversion_ids) {
+    if (!DeleteAdConversion(id)) {
+      return false;
+    }
   }
 
-  return false;
+  // |ad_conversions| now only contains ad conversions which were added
+  for (const auto& key : ad_conversions) {
+    ads::AdConversionTrackingInfo ad_conversion;
+    ad_conversion.creative_set_id = std::get<0>(key);
+    ad_conversion.type = std::get<1>(key);
+    ad_conversion.url_pattern = std::get<2>(key);
+    ad_conversion.observation_window = std::get<3>(key);
+
+    if (!InsertOrUpdateAdConversion(ad_conversion)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool BundleStateDatabase::DeleteCategory(
+    const std::string& category) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "DELETE FROM category WHERE name = ?"));
+
+  statement.BindString(0, category);
+
+  return statement.Run();
+}
+
+bool BundleStateDatabase::DeleteAdInfo(
+    const std::string& region,
+    const std::string& uuid) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "DELETE FROM ad_info WHERE region = ? AND uuid = ?"));
+
+  statement.BindString(0, region);
+  statement.BindString(1, uuid);
+
+  return statement.Run();
+}
+
+bool BundleStateDatabase::DeleteAdInfoCategory(
+    const std::string& uuid,
+    const std::string& category) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "DELETE FROM ad_info_category "
+      "WHERE ad_info_uuid = ? AND category_name = ?"));
+
+  statement.BindString(0, uuid);
+  statement.BindString(1, category);
+
+  return statement.Run();
+}
+
+bool BundleStateDatabase::DeleteAdConversion(
+    const int64_t id) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "DELETE FROM ad_conversions WHERE id = ?"));
+
+  statement.BindInt64(0, id);
+
+  return statement.Run();
+}
+
+bool BundleStateDatabase::UpdateAdInfoIfChanged(
+    const ads::AdInfo& info,
+    const std::string& region) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  // The row is only written if a column changed, so unchanged ads do not
+  // dirty any pages
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE,
+      "UPDATE ad_info SET "
+      "creative_set_id = ?1, advertiser = ?2, notification_text = ?3, "
+      "notification_url = ?4, start_timestamp = datetime(?5), "
+      "end_timestamp = datetime(?6), campaign_id = ?7, daily_cap = ?8, "
+      "per_day = ?9, total_max = ?10 "
+      "WHERE region = ?11 AND uuid = ?12 AND ("
+      "creative_set_id IS NOT ?1 OR advertiser IS NOT ?2 OR "
+      "notification_text IS NOT ?3 OR notification_url IS NOT ?4 OR "
+      "start_timestamp IS NOT datetime(?5) OR "
+      "end_timestamp IS NOT datetime(?6) OR campaign_id IS NOT ?7 OR "
+      "daily_cap IS NOT ?8 OR per_day IS NOT ?9 OR total_max IS NOT ?10)"));
+
+  statement.BindString(0, info.creative_set_id);
+  statement.BindString(1, info.advertiser);
+  statement.BindString(2, info.notification_text);
+  statement.BindString(3, info.notification_url);
+  statement.BindString(4, info.start_timestamp);
+  statement.BindString(5, info.end_timestamp);
+  statement.BindString(6, info.campaign_id);
+  statement.BindInt(7, info.daily_cap);
+  statement.BindInt(8, info.per_day);
+  statement.BindInt(9, info.total_max);
+  statement.BindString(10, region);
+  statement.BindString(11, info.uuid);
+
+  return statement.Run();
 }
 
 bool BundleStateDatabase::InsertOrUpdateCategory(const std::string& category) {
@@ -315,7 +580,9 @@ bool BundleStateDatabase::InsertOrUpdateCategory(const std::string& category) {
   return ad_info_statement.Run();
 }
 
-bool BundleStateDatabase::InsertOrUpdateAdInfo(const ads::AdInfo& info) {
+bool BundleStateDatabase::InsertOrUpdateAdInfo(
+    const ads::AdInfo& info,
+    const std::string& region) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
   bool initialized = Init();
@@ -324,33 +591,28 @@ bool BundleStateDatabase::InsertOrUpdateAdInfo(const ads::AdInfo& info) {
   if (!initialized)
     return false;
 
-  for (auto it = info.regions.begin(); it != info.regions.end(); ++it) {
-    sql::Statement ad_info_statement(
-        GetDB().GetCachedStatement(SQL_FROM_HERE,
-            "INSERT OR REPLACE INTO ad_info "
-            "(creative_set_id, advertiser, notification_text, "
-            "notification_url, start_timestamp, end_timestamp, uuid, "
-            "campaign_id, daily_cap, per_day, total_max, region) "
-            "VALUES (?, ?, ?, ?, datetime(?), datetime(?), ?, ?, ?, ?, ?, ?)"));
-
-    ad_info_statement.BindString(0, info.creative_set_id);
-    ad_info_statement.BindString(1, info.advertiser);
-    ad_info_statement.BindString(2, info.notification_text);
-    ad_info_statement.BindString(3, info.notification_url);
-    ad_info_statement.BindString(4, info.start_timestamp);
-    ad_info_statement.BindString(5, info.end_timestamp);
-    ad_info_statement.BindString(6, info.uuid);
-    ad_info_statement.BindString(7, info.campaign_id);
-    ad_info_statement.BindInt(8, info.daily_cap);
-    ad_info_statement.BindInt(9, info.per_day);
-    ad_info_statement.BindInt(10, info.total_max);
-    ad_info_statement.BindString(11, *it);
-    if (!ad_info_statement.Run()) {
-      return false;
-    }
-  }
+  sql::Statement ad_info_statement(
+      GetDB().GetCachedStatement(SQL_FROM_HERE,
+          "INSERT OR REPLACE INTO ad_info "
+          "(creative_set_id, advertiser, notification_text, "
+          "notification_url, start_timestamp, end_timestamp, uuid, "
+          "campaign_id, daily_cap, per_day, total_max, region) "
+          "VALUES (?, ?, ?, ?, datetime(?), datetime(?), ?, ?, ?, ?, ?, ?)"));
+
+  ad_info_statement.BindString(0, info.creative_set_id);
+  ad_info_statement.BindString(1, info.advertiser);
+  ad_info_statement.BindString(2, info.notification_text);
+  ad_info_statement.BindString(3, info.notification_url);
+  ad_info_statement.BindString(4, info.start_timestamp);
+  ad_info_statement.BindString(5, info.end_timestamp);
+  ad_info_statement.BindString(6, info.uuid);
+  ad_info_statement.BindString(7, info.campaign_id);
+  ad_info_statement.BindInt(8, info.daily_cap);
+  ad_info_statement.BindInt(9, info.per_day);
+  ad_info_statement.BindInt(10, info.total_max);
+  ad_info_statement.BindString(11, region);
 
-  return true;
+  return ad_info_statement.Run();
 }
 
 bool BundleStateDatabase::InsertOrUpdateAdConversion(
@@ -379,7 +641,7 @@ bool BundleStateDatabase::InsertOrUpdateAdConversion(
 }
 
 bool BundleStateDatabase::InsertOrUpdateAdInfoCategory(
-    const ads::AdInfo& ad_info,
+    const std::string& uuid,
     const std::string& category) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
@@ -395,7 +657,7 @@ bool BundleStateDatabase::InsertOrUpdateAdInfoCategory(
           "(ad_info_uuid, category_name) "
           "VALUES (?, ?)"));
 
-  ad_info_statement.BindString(0, ad_info.uuid);
+  ad_info_statement.BindString(0, uuid);
   ad_info_statement.BindString(1, category);
 
   return ad_info_statement.Run();
@@ -412,37 +674,22 @@ bool BundleStateDatabase::GetAdsForCategory(
   if (!initialized)
     return false;
 
-  sql::Statement info_sql(
-      db_.GetUniqueStatement(
-          "SELECT ai.creative_set_id, ai.advertiser, "
-          "ai.notification_text, ai.notification_url, "
-          "ai.start_timestamp, ai.end_timestamp, "
-          "ai.uuid, ai.region, ai.campaign_id, ai.daily_cap, "
-          "ai.per_day, ai.total_max FROM ad_info AS ai "
-          "INNER JOIN ad_info_category AS aic "
-          "ON aic.ad_info_uuid = ai.uuid "
-          "WHERE aic.category_name = ? and "
-          "ai.start_timestamp <= strftime('%Y-%m-%d %H:%M', "
-          "datetime('now','localtime')) and "
-          "ai.end_timestamp >= strftime('%Y-%m-%d %H:%M', "
-          "datetime('now','localtime'));"));
-  info_sql.BindString(0, category);
+  if (!is_ads_index_loaded_ && !LoadAdsIndex())
+    return false;
 
-  while (info_sql.Step()) {
-    ads::AdInfo info;
-    info.creative_set_id = info_sql.ColumnString(0);
-    info.advertiser = info_sql.ColumnString(1);
-    info.category = category;
-    info.notification_text = info_sql.ColumnString(2);
-    info.notification_url = info_sql.ColumnString(3);
-    info.start_timestamp = info_sql.ColumnString(4);
-    info.end_timestamp = info_sql.ColumnString(5);
-    info.uuid = info_sql.ColumnString(6);
-    info.campaign_id = info_sql.ColumnString(8);
-    info.daily_cap = info_sql.ColumnInt(9);
-    info.per_day = info_sql.ColumnInt(10);
-    info.total_max = info_sql.ColumnInt(11);
-    ads->emplace_back(info);
+  auto it = ads_index_.find(category);
+  if (it == ads_index_.end())
+    return true;
+
+  // Timestamps are compared as strings in the same format as the timestamps
+  // stored by |InsertOrUpdateAdInfo|
+  const std::string now = GetLocalTimestamp(base::Time::Now());
+
+  for (const auto& ad : it->second) {
+    if (ad.start_timestamp > now || ad.end_timestamp < now)
+      continue;
+
+    ads->push_back(ad);
   }
 
   return true;
@@ -499,10 +746,99 @@ void BundleStateDatabase::Vacuum() {
   ignore_result(db_.Execute("VACUUM"));
 }
 
+void BundleStateDatabase::MaybeVacuum() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (!initialized_)
+    return;
+
+  if (GetFreelistRatio() < kVacuumFreelistRatio)
+    return;
+
+  Vacuum();
+}
+
+double BundleStateDatabase::GetFreelistRatio() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement page_count_statement(
+      GetDB().GetUniqueStatement("PRAGMA page_count"));
+  if (!page_count_statement.Step())
+    return 0.0;
+
+  const int64_t page_count = page_count_statement.ColumnInt64(0);
+  if (page_count == 0)
+    return 0.0;
+
+  sql::Statement freelist_count_statement(
+      GetDB().GetUniqueStatement("PRAGMA freelist_count"));
+  if (!freelist_count_statement.Step())
+    return 0.0;
+
+  const int64_t freelist_count = freelist_count_statement.ColumnInt64(0);
+
+  return static_cast<double>(freelist_count) / page_count;
+}
+
+bool BundleStateDatabase::LoadAdsIndex() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  ResetAdsIndex();
+
+  sql::Statement info_sql(
+      db_.GetUniqueStatement(
+          "SELECT aic.category_name, ai.creative_set_id, ai.advertiser, "
+          "ai.notification_text, ai.notification_url, "
+          "ai.start_timestamp, ai.end_timestamp, "
+          "ai.uuid, ai.campaign_id, ai.daily_cap, "
+          "ai.per_day, ai.total_max FROM ad_info AS ai "
+          "INNER JOIN ad_info_category AS aic "
+          "ON aic.ad_info_uuid = ai.uuid"));
+
+  while (info_sql.Step()) {
+    ads::AdInfo info;
+    info.category = info_sql.ColumnString(0);
+    info.creative_set_id = info_sql.ColumnString(1);
+    info.advertiser = info_sql.ColumnString(2);
+    info.notification_text = info_sql.ColumnString(3);
+    info.notification_url = info_sql.ColumnString(4);
+    info.start_timestamp = info_sql.ColumnString(5);
+    info.end_timestamp = info_sql.ColumnString(6);
+    info.uuid = info_sql.ColumnString(7);
+    info.campaign_id = info_sql.ColumnString(8);
+    info.daily_cap = info_sql.ColumnInt(9);
+    info.per_day = info_sql.ColumnInt(10);
+    info.total_max = info_sql.ColumnInt(11);
+    ads_index_[info.category].push_back(info);
+  }
+
+  if (!info_sql.Succeeded()) {
+    ResetAdsIndex();
+    return false;
+  }
+
+  is_ads_index_loaded_ = true;
+
+  return true;
+}
+
+void BundleStateDatabase::ResetAdsIndex() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  ads_index_.clear();
+  is_ads_index_loaded_ = false;
+}
+
 void BundleStateDatabase::OnMemoryPressure(
     base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   db_.TrimMemory();
+
+  // The index is reloaded from the database the next time an ad is served
+  if (memory_pressure_level ==
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL) {
+    ResetAdsIndex();
+  }
 }
 
 std::string BundleStateDatabase::GetDiagnosticInfo(int extended_error,
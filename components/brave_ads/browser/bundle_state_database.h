@@ -7,6 +7,8 @@
 #define BRAVE_COMPONENTS_BRAVE_ADS_BROWSER_BUNDLE_STATE_DATABASE_H_
 
 #include <stddef.h>
+#include <stdint.h>
+#include <map>
 #include <string>
 #include <vector>
 #include <memory>
@@ -39,6 +41,8 @@ class BundleStateDatabase {
 
   bool SaveBundleState(const ads::BundleState& bundle_state);
 
+  // Ads are served from an in-memory index of the bundle which is loaded on
+  // first use and invalidated when the bundle state is saved
   bool GetAdsForCategory(
       const std::string& category,
       std::vector<ads::AdInfo>* ads);
@@ -53,6 +57,10 @@ class BundleStateDatabase {
   // unused space in the file. It can be VERY SLOW.
   void Vacuum();
 
+  // Vacuums the database if the proportion of unused pages is large enough to
+  // be worth the cost. Should be called when the user is idle
+  void MaybeVacuum();
+
   std::string GetDiagnosticInfo(int extended_error, sql::Statement* statement);
 
  private:
@@ -66,21 +74,51 @@ class BundleStateDatabase {
   bool CreateAdInfoCategoryTable();
   bool CreateAdInfoCategoryNameIndex();
 
-  bool TruncateCategoryTable();
-  bool TruncateConversionsTable();
-  bool TruncateAdInfoTable();
-  bool TruncateAdInfoCategoryTable();
+  bool IsCatalogSaved(
+      const ads::BundleState& bundle_state);
+  bool SetCatalog(
+      const ads::BundleState& bundle_state);
+
+  bool UpdateCategories(
+      const ads::BundleState& bundle_state);
+  bool UpdateAdInfo(
+      const ads::BundleState& bundle_state);
+  bool UpdateAdInfoCategories(
+      const ads::BundleState& bundle_state);
+  bool UpdateAdConversions(
+      const ads::BundleState& bundle_state);
+
+  bool DeleteCategory(
+      const std::string& category);
+  bool DeleteAdInfo(
+      const std::string& region,
+      const std::string& uuid);
+  bool DeleteAdInfoCategory(
+      const std::string& uuid,
+      const std::string& category);
+  bool DeleteAdConversion(
+      const int64_t id);
+
+  bool UpdateAdInfoIfChanged(
+      const ads::AdInfo& info,
+      const std::string& region);
 
   bool InsertOrUpdateCategory(
       const std::string& category);
   bool InsertOrUpdateAdConversion(
       const ads::AdConversionTrackingInfo& ad_conversion);
   bool InsertOrUpdateAdInfo(
-      const ads::AdInfo& info);
+      const ads::AdInfo& info,
+      const std::string& region);
   bool InsertOrUpdateAdInfoCategory(
-      const ads::AdInfo& ad_info,
+      const std::string& uuid,
       const std::string& category);
 
+  double GetFreelistRatio();
+
+  bool LoadAdsIndex();
+  void ResetAdsIndex();
+
   sql::Database& GetDB();
   sql::MetaTable& GetMetaTable();
 
@@ -93,6 +131,10 @@ class BundleStateDatabase {
   const base::FilePath db_path_;
   bool initialized_;
 
+  // Ads keyed by category, one per region as stored in the ad_info table
+  std::map<std::string, std::vector<ads::AdInfo>> ads_index_;
+  bool is_ads_index_loaded_;
+
   std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
 
   SEQUENCE_CHECKER(sequence_checker_);
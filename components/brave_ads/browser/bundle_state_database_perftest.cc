@@ -0,0 +1,168 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/stringprintf.h"
+#include "base/timer/elapsed_timer.h"
+#include "brave/components/brave_ads/browser/bundle_state_database.h"
+#include "sql/database.h"
+#include "sql/statement.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_test.h"
+
+// npm run test -- brave_perftests --filter=BundleStateDatabasePerfTest.*
+
+namespace brave_ads {
+
+namespace {
+
+const size_t kCreativeCount = 10000;
+
+// Of the order of the taxonomies the user model classifies pages into
+const size_t kCategoryCount = 300;
+
+// Each creative is targeted at a segment and its top level segment
+const size_t kCategoriesPerCreative = 2;
+
+// Serving an ad queries the winning categories and then their parents
+const size_t kCategoriesPerServe = 3;
+
+const size_t kServeIterations = 200;
+
+std::string GetCategory(
+    const size_t index) {
+  return base::StringPrintf("category%zu", index % kCategoryCount);
+}
+
+ads::AdInfo GetAdInfo(
+    const size_t index) {
+  ads::AdInfo ad_info;
+  ad_info.creative_set_id = base::StringPrintf("creative-set-%zu", index / 4);
+  ad_info.campaign_id = base::StringPrintf("campaign-%zu", index / 20);
+  ad_info.advertiser = "Brave";
+  ad_info.notification_text = "Ad notification text";
+  ad_info.notification_url = "https://brave.com";
+  ad_info.start_timestamp = "2000-01-01T00:00:00.000Z";
+  ad_info.end_timestamp = "2100-01-01T00:00:00.000Z";
+  ad_info.uuid = base::StringPrintf("creative-instance-%zu", index);
+  ad_info.regions = {"US"};
+  ad_info.daily_cap = 1;
+  ad_info.per_day = 2;
+  ad_info.total_max = 3;
+  return ad_info;
+}
+
+}  // namespace
+
+class BundleStateDatabasePerfTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    db_path_ = temp_dir_.GetPath().AppendASCII("BundleStateDatabase.db");
+
+    ads::BundleState bundle_state;
+    bundle_state.catalog_id = "catalog";
+    bundle_state.catalog_version = 1;
+    for (size_t i = 0; i < kCreativeCount; i++) {
+      const ads::AdInfo ad_info = GetAdInfo(i);
+      for (size_t j = 0; j < kCategoriesPerCreative; j++) {
+        bundle_state.categories[GetCategory(i + j)].push_back(ad_info);
+      }
+    }
+
+    bundle_state_database_ = std::make_unique<BundleStateDatabase>(db_path_);
+    ASSERT_TRUE(bundle_state_database_->SaveBundleState(bundle_state));
+  }
+
+  void Report(
+      const std::string& trace,
+      const base::TimeDelta& elapsed) {
+    const std::string modifier =
+        "_" + base::NumberToString(kCreativeCount) + "_creatives";
+
+    perf_test::PrintResult("serve_ad", modifier, trace,
+        elapsed.InMicrosecondsF() / kServeIterations, "us", true);
+  }
+
+  base::ScopedTempDir temp_dir_;
+  base::FilePath db_path_;
+  std::unique_ptr<BundleStateDatabase> bundle_state_database_;
+};
+
+TEST_F(BundleStateDatabasePerfTest, GetAdsForCategory) {
+  // Querying the database once per category, as ads were served before the
+  // in-memory index
+  sql::Database db;
+  ASSERT_TRUE(db.Open(db_path_));
+
+  base::ElapsedTimer sqlite_timer;
+  size_t sqlite_ad_count = 0;
+  for (size_t i = 0; i < kServeIterations; i++) {
+    for (size_t j = 0; j < kCategoriesPerServe; j++) {
+      sql::Statement info_sql(
+          db.GetUniqueStatement(
+              "SELECT ai.creative_set_id, ai.advertiser, "
+              "ai.notification_text, ai.notification_url, "
+              "ai.start_timestamp, ai.end_timestamp, "
+              "ai.uuid, ai.region, ai.campaign_id, ai.daily_cap, "
+              "ai.per_day, ai.total_max FROM ad_info AS ai "
+              "INNER JOIN ad_info_category AS aic "
+              "ON aic.ad_info_uuid = ai.uuid "
+              "WHERE aic.category_name = ? and "
+              "ai.start_timestamp <= strftime('%Y-%m-%d %H:%M', "
+              "datetime('now','localtime')) and "
+              "ai.end_timestamp >= strftime('%Y-%m-%d %H:%M', "
+              "datetime('now','localtime'));"));
+      info_sql.BindString(0, GetCategory(i + j));
+
+      while (info_sql.Step()) {
+        ads::AdInfo info;
+        info.creative_set_id = info_sql.ColumnString(0);
+        info.advertiser = info_sql.ColumnString(1);
+        info.notification_text = info_sql.ColumnString(2);
+        info.notification_url = info_sql.ColumnString(3);
+        info.start_timestamp = info_sql.ColumnString(4);
+        info.end_timestamp = info_sql.ColumnString(5);
+        info.uuid = info_sql.ColumnString(6);
+        info.campaign_id = info_sql.ColumnString(8);
+        info.daily_cap = info_sql.ColumnInt(9);
+        info.per_day = info_sql.ColumnInt(10);
+        info.total_max = info_sql.ColumnInt(11);
+        sqlite_ad_count++;
+      }
+    }
+  }
+  Report("sqlite", sqlite_timer.Elapsed());
+
+  // Loading the in-memory index, which happens once per catalog
+  base::ElapsedTimer load_timer;
+  std::vector<ads::AdInfo> ads;
+  ASSERT_TRUE(bundle_state_database_->GetAdsForCategory(GetCategory(0),
+      &ads));
+  perf_test::PrintResult("load_ads_index", "", "index",
+      load_timer.Elapsed().InMillisecondsF(), "ms", true);
+
+  base::ElapsedTimer index_timer;
+  size_t index_ad_count = 0;
+  for (size_t i = 0; i < kServeIterations; i++) {
+    for (size_t j = 0; j < kCategoriesPerServe; j++) {
+      std::vector<ads::AdInfo> ads;
+      ASSERT_TRUE(bundle_state_database_->GetAdsForCategory(
+          GetCategory(i + j), &ads));
+      index_ad_count += ads.size();
+    }
+  }
+  Report("index", index_timer.Elapsed());
+
+  EXPECT_EQ(sqlite_ad_count, index_ad_count);
+}
+
+}  // namespace brave_ads
@@ -0,0 +1,248 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "brave/components/brave_ads/browser/bundle_state_database.h"
+
+#include "base/files/file_path.h"
+#include "base/files/scoped_temp_dir.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BundleStateDatabaseTest.*
+
+namespace brave_ads {
+
+namespace {
+
+ads::AdInfo GetAdInfo(
+    const std::string& uuid,
+    const std::string& notification_text) {
+  ads::AdInfo ad_info;
+  ad_info.creative_set_id = "creative-set-" + uuid;
+  ad_info.campaign_id = "campaign-" + uuid;
+  ad_info.advertiser = "Brave";
+  ad_info.notification_text = notification_text;
+  ad_info.notification_url = "https://brave.com";
+  ad_info.start_timestamp = "2000-01-01T00:00:00.000Z";
+  ad_info.end_timestamp = "2100-01-01T00:00:00.000Z";
+  ad_info.uuid = uuid;
+  ad_info.regions = {"US", "GB"};
+  ad_info.daily_cap = 1;
+  ad_info.per_day = 2;
+  ad_info.total_max = 3;
+  return ad_info;
+}
+
+std::vector<std::string> GetNotificationTexts(
+    const std::vector<ads::AdInfo>& ads) {
+  std::vector<std::string> notification_texts;
+  for (const auto& ad : ads) {
+    notification_texts.push_back(ad.uuid + ":" + ad.notification_text);
+  }
+
+  return notification_texts;
+}
+
+}  // namespace
+
+class BundleStateDatabaseTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    bundle_state_database_ = std::make_unique<BundleStateDatabase>(
+        temp_dir_.GetPath().AppendASCII("BundleStateDatabaseTest.db"));
+  }
+
+  std::vector<ads::AdInfo> GetAdsForCategory(
+      const std::string& category) {
+    std::vector<ads::AdInfo> ads;
+    EXPECT_TRUE(bundle_state_database_->GetAdsForCategory(category, &ads));
+    return ads;
+  }
+
+  base::ScopedTempDir temp_dir_;
+  std::unique_ptr<BundleStateDatabase> bundle_state_database_;
+};
+
+TEST_F(BundleStateDatabaseTest, AppliesChangesBetweenCatalogs) {
+  // Arrange
+  ads::BundleState bundle_state;
+  bundle_state.catalog_id = "catalog-1";
+  bundle_state.catalog_version = 1;
+  bundle_state.categories["technology & computing"] = {
+    GetAdInfo("1", "Unchanged"),
+    GetAdInfo("2", "Changed")
+  };
+  bundle_state.categories["travel"] = {
+    GetAdInfo("3", "Removed")
+  };
+  ASSERT_TRUE(bundle_state_database_->SaveBundleState(bundle_state));
+
+  // Act
+  bundle_state.catalog_id = "catalog-2";
+  bundle_state.categories.erase("travel");
+  bundle_state.categories["technology & computing"] = {
+    GetAdInfo("1", "Unchanged"),
+    GetAdInfo("2", "Updated"),
+    GetAdInfo("4", "Added")
+  };
+  ASSERT_TRUE(bundle_state_database_->SaveBundleState(bundle_state));
+
+  // Assert
+  std::vector<std::string> notification_texts =
+      GetNotificationTexts(GetAdsForCategory("technology & computing"));
+  std::sort(notification_texts.begin(), notification_texts.end());
+
+  // Each ad is returned once per region
+  const std::vector<std::string> expected_notification_texts = {
+    "1:Unchanged", "1:Unchanged",
+    "2:Updated", "2:Updated",
+    "4:Added", "4:Added"
+  };
+  EXPECT_EQ(expected_notification_texts, notification_texts);
+
+  EXPECT_TRUE(GetAdsForCategory("travel").empty());
+}
+
+TEST_F(BundleStateDatabaseTest, AppliesChangesToAdConversions) {
+  // Arrange
+  ads::AdConversionTrackingInfo ad_conversion;
+  ad_conversion.creative_set_id = "creative-set-1";
+  ad_conversion.type = "postview";
+  ad_conversion.url_pattern = "https://brave.com/*";
+  ad_conversion.observation_window = 3;
+
+  ads::BundleState bundle_state;
+  bundle_state.catalog_id = "catalog-1";
+  bundle_state.catalog_version = 1;
+  bundle_state.ad_conversions = {ad_conversion, ad_conversion};
+  ASSERT_TRUE(bundle_state_database_->SaveBundleState(bundle_state));
+
+  // Act
+  ads::AdConversionTrackingInfo added_ad_conversion = ad_conversion;
+  added_ad_conversion.creative_set_id = "creative-set-2";
+
+  bundle_state.catalog_id = "catalog-2";
+  bundle_state.ad_conversions = {ad_conversion, added_ad_conversion};
+  ASSERT_TRUE(bundle_state_database_->SaveBundleState(bundle_state));
+
+  // Assert
+  std::vector<ads::AdConversionTrackingInfo> ad_conversions;
+  ASSERT_TRUE(bundle_state_database_->GetAdConversions("",
+      &ad_conversions));
+
+  std::vector<std::string> creative_set_ids;
+  for (const auto& ad_conversion : ad_conversions) {
+    creative_set_ids.push_back(ad_conversion.creative_set_id);
+  }
+  std::sort(creative_set_ids.begin(), creative_set_ids.end());
+
+  const std::vector<std::string> expected_creative_set_ids = {
+    "creative-set-1",
+    "creative-set-2"
+  };
+  EXPECT_EQ(expected_creative_set_ids, creative_set_ids);
+}
+
+TEST_F(BundleStateDatabaseTest, DoesNotResaveSameCatalog) {
+  // Arrange
+  ads::BundleState bundle_state;
+  bundle_state.catalog_id = "catalog-1";
+  bundle_state.catalog_version = 1;
+  bundle_state.categories["travel"] = {
+    GetAdInfo("1", "Saved")
+  };
+  ASSERT_TRUE(bundle_state_database_->SaveBundleState(bundle_state));
+
+  // Act
+  bundle_state.categories["travel"] = {
+    GetAdInfo("1", "Not saved")
+  };
+  ASSERT_TRUE(bundle_state_database_->SaveBundleState(bundle_state));
+
+  // Assert
+  const std::vector<std::string> expected_notification_texts = {
+    "1:Saved", "1:Saved"
+  };
+  EXPECT_EQ(expected_notification_texts,
+      GetNotificationTexts(GetAdsForCategory("travel")));
+}
+
+TEST_F(BundleStateDatabaseTest, InvalidatesAdsIndexWhenSaved) {
+  // Arrange
+  ads::BundleState bundle_state;
+  bundle_state.catalog_id = "catalog-1";
+  bundle_state.catalog_version = 1;
+  bundle_state.categories["travel"] = {
+    GetAdInfo("1", "Old")
+  };
+  ASSERT_TRUE(bundle_state_database_->SaveBundleState(bundle_state));
+  ASSERT_EQ(2UL, GetAdsForCategory("travel").size());
+
+  // Act
+  bundle_state.catalog_id = "catalog-2";
+  bundle_state.categories["travel"] = {
+    GetAdInfo("1", "New")
+  };
+  ASSERT_TRUE(bundle_state_database_->SaveBundleState(bundle_state));
+
+  // Assert
+  const std::vector<std::string> expected_notification_texts = {
+    "1:New", "1:New"
+  };
+  EXPECT_EQ(expected_notification_texts,
+      GetNotificationTexts(GetAdsForCategory("travel")));
+}
+
+TEST_F(BundleStateDatabaseTest, DoesNotServeExpiredAds) {
+  // Arrange
+  ads::AdInfo expired_ad_info = GetAdInfo("1", "Expired");
+  expired_ad_info.end_timestamp = "2001-01-01T00:00:00.000Z";
+
+  ads::AdInfo scheduled_ad_info = GetAdInfo("2", "Scheduled");
+  scheduled_ad_info.start_timestamp = "2099-01-01T00:00:00.000Z";
+
+  ads::BundleState bundle_state;
+  bundle_state.catalog_id = "catalog-1";
+  bundle_state.catalog_version = 1;
+  bundle_state.categories["travel"] = {
+    expired_ad_info,
+    scheduled_ad_info,
+    GetAdInfo("3", "Active")
+  };
+  ASSERT_TRUE(bundle_state_database_->SaveBundleState(bundle_state));
+
+  // Act
+  const std::vector<ads::AdInfo> ads = GetAdsForCategory("travel");
+
+  // Assert
+  const std::vector<std::string> expected_notification_texts = {
+    "3:Active", "3:Active"
+  };
+  EXPECT_EQ(expected_notification_texts, GetNotificationTexts(ads));
+}
+
+TEST_F(BundleStateDatabaseTest, ResetRemovesAllRows) {
+  // Arrange
+  ads::BundleState bundle_state;
+  bundle_state.catalog_id = "catalog-1";
+  bundle_state.catalog_version = 1;
+  bundle_state.categories["travel"] = {
+    GetAdInfo("1", "Removed")
+  };
+  ASSERT_TRUE(bundle_state_database_->SaveBundleState(bundle_state));
+
+  // Act
+  ASSERT_TRUE(bundle_state_database_->SaveBundleState(ads::BundleState()));
+
+  // Assert
+  EXPECT_TRUE(GetAdsForCategory("travel").empty());
+}
+
+}  // namespace brave_ads
@@ -33,4 +33,17 @@ namespace brave_rewards {
     reconcile_stamp = properties.reconcile_stamp;
   }
 
+  ContentSiteCursor::ContentSiteCursor() : percentage(0) {}
+
+  ContentSiteCursor::ContentSiteCursor(
+      const ContentSiteCursor& cursor) = default;
+
+  ContentSiteCursor::~ContentSiteCursor() {}
+
+  ContentSitePage::ContentSitePage() : total(0) {}
+
+  ContentSitePage::ContentSitePage(const ContentSitePage& page) = default;
+
+  ContentSitePage::~ContentSitePage() {}
+
 }  // namespace brave_rewards
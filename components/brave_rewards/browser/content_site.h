@@ -38,6 +38,29 @@ struct ContentSite {
 
 typedef std::vector<ContentSite> ContentSiteList;
 
+// Position in the auto-contribute list, sorted by percentage DESC and id ASC.
+// An empty |id| points at the start of the list
+struct ContentSiteCursor {
+  ContentSiteCursor();
+  ContentSiteCursor(const ContentSiteCursor& cursor);
+  ~ContentSiteCursor();
+
+  uint32_t percentage;
+  std::string id;
+};
+
+struct ContentSitePage {
+  ContentSitePage();
+  ContentSitePage(const ContentSitePage& page);
+  ~ContentSitePage();
+
+  ContentSiteList list;
+  // Number of sites in the whole list, not only in this page
+  uint32_t total;
+  // Cursor for the next page, |next.id| is empty on the last page
+  ContentSiteCursor next;
+};
+
 }  // namespace brave_rewards
 
 #endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_CONTENT_SITE_H_
@@ -11,7 +11,6 @@
 #include "brave/components/brave_rewards/browser/database/database_activity_info.h"
 #include "brave/components/brave_rewards/browser/database/database_util.h"
 #include "sql/statement.h"
-#include "sql/transaction.h"
 
 namespace brave_rewards {
 
@@ -82,11 +81,12 @@ std::string GenerateActivityFilterQuery(
   return query;
 }
 
-void GenerateActivityFilterBind(
+// Returns the index of the next column to bind
+int GenerateActivityFilterBind(
     sql::Statement* statement,
     ledger::ActivityInfoFilterPtr filter) {
   if (!statement || !filter) {
-    return;
+    return 0;
   }
 
   int column = 0;
@@ -121,6 +121,59 @@ void GenerateActivityFilterBind(
   if (filter->min_visits > 0) {
     statement->BindInt(column++, filter->min_visits);
   }
+
+  return column;
+}
+
+// Only the filter conditions, ordering and paging are left to the caller
+std::string GenerateActivityFilterWhereQuery(
+    ledger::ActivityInfoFilterPtr filter) {
+  if (!filter) {
+    return "";
+  }
+
+  filter->order_by.clear();
+  return GenerateActivityFilterQuery(0, 0, std::move(filter));
+}
+
+void ReadActivityRecords(
+    sql::Statement* statement,
+    ledger::PublisherInfoList* list) {
+  while (statement->Step()) {
+    auto info = ledger::PublisherInfo::New();
+    info->id = statement->ColumnString(0);
+    info->duration = statement->ColumnInt64(1);
+    info->score = statement->ColumnDouble(2);
+    info->percent = statement->ColumnInt64(3);
+    info->weight = statement->ColumnDouble(4);
+    info->status =
+        static_cast<ledger::mojom::PublisherStatus>(statement->ColumnInt64(5));
+    info->excluded = static_cast<ledger::PublisherExclude>(
+        statement->ColumnInt(6));
+    info->name = statement->ColumnString(7);
+    info->url = statement->ColumnString(8);
+    info->provider = statement->ColumnString(9);
+    info->favicon_url = statement->ColumnString(10);
+    info->reconcile_stamp = statement->ColumnInt64(11);
+    info->visits = statement->ColumnInt(12);
+
+    list->push_back(std::move(info));
+  }
+}
+
+std::string GetRecordsSelectQuery() {
+  return base::StringPrintf(
+    "SELECT ai.publisher_id, ai.duration, ai.score, "
+    "ai.percent, ai.weight, spi.status, pi.excluded, "
+    "pi.name, pi.url, pi.provider, "
+    "pi.favIcon, ai.reconcile_stamp, ai.visits "
+    "FROM %s AS ai "
+    "INNER JOIN publisher_info AS pi "
+    "ON ai.publisher_id = pi.publisher_id "
+    "LEFT JOIN server_publisher_info AS spi "
+    "ON spi.publisher_key = pi.publisher_id "
+    "WHERE 1 = 1",
+    table_name_);
 }
 
 DatabaseActivityInfo::DatabaseActivityInfo(
@@ -257,6 +310,16 @@ bool DatabaseActivityInfo::CreateIndexV15(sql::Database* db) {
   return this->InsertIndex(db, table_name_, "publisher_id");
 }
 
+bool DatabaseActivityInfo::CreateIndexV16(sql::Database* db) {
+  // Covers the reconcile stamp, duration and visits filters of the
+  // activity list
+  return this->InsertIndex(
+      db,
+      table_name_,
+      "reconcile_stamp",
+      { "reconcile_stamp", "duration", "visits", "publisher_id" });
+}
+
 bool DatabaseActivityInfo::Migrate(sql::Database* db, const int target) {
   switch (target) {
     case 1: {
@@ -277,6 +340,9 @@ bool DatabaseActivityInfo::Migrate(sql::Database* db, const int target) {
     case 15: {
       return MigrateToV15(db);
     }
+    case 16: {
+      return MigrateToV16(db);
+    }
     default: {
       NOTREACHED();
       return false;
@@ -311,7 +377,7 @@ bool DatabaseActivityInfo::MigrateToV2(sql::Database* db) {
         column);
 
     sql::Statement statement(
-        db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
+        db->GetUniqueStatement(query.c_str()));
 
     return statement.Run();
   }
@@ -337,10 +403,6 @@ bool DatabaseActivityInfo::MigrateToV4(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV4(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "publisher_id", "publisher_id" },
     { "duration", "duration" },
@@ -356,6 +418,10 @@ bool DatabaseActivityInfo::MigrateToV4(sql::Database* db) {
     return false;
   }
 
+  if (!CreateIndexV4(db)) {
+    return false;
+  }
+
   sql = base::StringPrintf("UPDATE %s SET visits=5;", table_name_);
   if (!db->Execute(sql.c_str())) {
     return false;
@@ -365,37 +431,12 @@ bool DatabaseActivityInfo::MigrateToV4(sql::Database* db) {
 }
 
 bool DatabaseActivityInfo::MigrateToV5(sql::Database* db) {
-  sql::Transaction transaction(db);
-  if (!transaction.Begin()) {
-    return false;
-  }
-
-  const std::string query_update = base::StringPrintf(
-      "UPDATE %s SET visits = 1 "
-      "WHERE publisher_id = ? AND month = ? AND "
-      "year = ? AND reconcile_stamp = ?",
-      table_name_);
-
-  const std::string query_select = base::StringPrintf(
-      "SELECT publisher_id, month, year, reconcile_stamp "
-      "FROM %s WHERE visits = 0",
+  // Every row without visits gets a single visit
+  const std::string query = base::StringPrintf(
+      "UPDATE %s SET visits = 1 WHERE visits = 0",
       table_name_);
 
-  sql::Statement statement_select(
-      db->GetCachedStatement(SQL_FROM_HERE, query_select.c_str()));
-
-  while (statement_select.Step()) {
-    sql::Statement statement_update(
-        db->GetCachedStatement(SQL_FROM_HERE, query_update.c_str()));
-
-    statement_update.BindString(0, statement_select.ColumnString(0));
-    statement_update.BindInt(1, statement_select.ColumnInt(1));
-    statement_update.BindInt(2, statement_select.ColumnInt(2));
-    statement_update.BindInt64(3, statement_select.ColumnInt64(3));
-    statement_update.Run();
-  }
-
-  return transaction.Commit();
+  return db->Execute(query.c_str());
 }
 
 bool DatabaseActivityInfo::MigrateToV6(sql::Database* db) {
@@ -417,10 +458,6 @@ bool DatabaseActivityInfo::MigrateToV6(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV6(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "publisher_id", "publisher_id" },
     { "sum(duration) as duration", "duration" },
@@ -443,6 +480,10 @@ bool DatabaseActivityInfo::MigrateToV6(sql::Database* db) {
     return false;
   }
 
+  if (!CreateIndexV6(db)) {
+    return false;
+  }
+
   return true;
 }
 
@@ -465,10 +506,6 @@ bool DatabaseActivityInfo::MigrateToV15(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV15(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "publisher_id", "publisher_id" },
     { "duration", "duration" },
@@ -483,9 +520,17 @@ bool DatabaseActivityInfo::MigrateToV15(sql::Database* db) {
     return false;
   }
 
+  if (!CreateIndexV15(db)) {
+    return false;
+  }
+
   return true;
 }
 
+bool DatabaseActivityInfo::MigrateToV16(sql::Database* db) {
+  return CreateIndexV16(db);
+}
+
 bool DatabaseActivityInfo::InsertOrUpdate(
     sql::Database* db,
     ledger::PublisherInfoPtr info) {
@@ -525,49 +570,108 @@ bool DatabaseActivityInfo::GetRecordsList(
     return false;
   }
 
-  std::string query = base::StringPrintf(
-    "SELECT ai.publisher_id, ai.duration, ai.score, "
-    "ai.percent, ai.weight, spi.status, pi.excluded, "
-    "pi.name, pi.url, pi.provider, "
-    "pi.favIcon, ai.reconcile_stamp, ai.visits "
-    "FROM %s AS ai "
-    "INNER JOIN publisher_info AS pi "
-    "ON ai.publisher_id = pi.publisher_id "
-    "LEFT JOIN server_publisher_info AS spi "
-    "ON spi.publisher_key = pi.publisher_id "
-    "WHERE 1 = 1",
-    table_name_);
-
-  query += GenerateActivityFilterQuery(start, limit, filter->Clone());
+  const std::string query =
+      GetRecordsListQuery(start, limit, filter->Clone());
 
   sql::Statement statement(db->GetUniqueStatement(query.c_str()));
 
   GenerateActivityFilterBind(&statement, filter->Clone());
 
-  while (statement.Step()) {
-    auto info = ledger::PublisherInfo::New();
-    info->id = statement.ColumnString(0);
-    info->duration = statement.ColumnInt64(1);
-    info->score = statement.ColumnDouble(2);
-    info->percent = statement.ColumnInt64(3);
-    info->weight = statement.ColumnDouble(4);
-    info->status =
-        static_cast<ledger::mojom::PublisherStatus>(statement.ColumnInt64(5));
-    info->excluded = static_cast<ledger::PublisherExclude>(
-        statement.ColumnInt(6));
-    info->name = statement.ColumnString(7);
-    info->url = statement.ColumnString(8);
-    info->provider = statement.ColumnString(9);
-    info->favicon_url = statement.ColumnString(10);
-    info->reconcile_stamp = statement.ColumnInt64(11);
-    info->visits = statement.ColumnInt(12);
+  ReadActivityRecords(&statement, list);
 
-    list->push_back(std::move(info));
+  return true;
+}
+
+bool DatabaseActivityInfo::GetRecordsPage(
+    sql::Database* db,
+    ledger::ActivityInfoFilterPtr filter,
+    const uint32_t after_percent,
+    const std::string& after_publisher_key,
+    const int limit,
+    ledger::PublisherInfoList* list) {
+  DCHECK(list);
+  if (!list || !filter || limit <= 0) {
+    return false;
+  }
+
+  const bool has_cursor = !after_publisher_key.empty();
+  const std::string query =
+      GetRecordsPageQuery(filter->Clone(), has_cursor, limit);
+
+  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+
+  int column = GenerateActivityFilterBind(&statement, filter->Clone());
+
+  if (has_cursor) {
+    statement.BindInt64(column++, after_percent);
+    statement.BindInt64(column++, after_percent);
+    statement.BindString(column++, after_publisher_key);
   }
 
+  ReadActivityRecords(&statement, list);
+
   return true;
 }
 
+int DatabaseActivityInfo::GetRecordsCount(
+    sql::Database* db,
+    ledger::ActivityInfoFilterPtr filter) {
+  if (!filter) {
+    return 0;
+  }
+
+  const std::string query = base::StringPrintf(
+      "SELECT COUNT(*) "
+      "FROM %s AS ai "
+      "INNER JOIN publisher_info AS pi "
+      "ON ai.publisher_id = pi.publisher_id "
+      "LEFT JOIN server_publisher_info AS spi "
+      "ON spi.publisher_key = pi.publisher_id "
+      "WHERE 1 = 1",
+      table_name_) + GenerateActivityFilterWhereQuery(filter->Clone());
+
+  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+
+  GenerateActivityFilterBind(&statement, filter->Clone());
+
+  if (!statement.Step()) {
+    return 0;
+  }
+
+  return statement.ColumnInt(0);
+}
+
+// static
+std::string DatabaseActivityInfo::GetRecordsListQuery(
+    const int start,
+    const int limit,
+    ledger::ActivityInfoFilterPtr filter) {
+  std::string query = GetRecordsSelectQuery();
+  query += GenerateActivityFilterQuery(start, limit, std::move(filter));
+  return query;
+}
+
+// static
+std::string DatabaseActivityInfo::GetRecordsPageQuery(
+    ledger::ActivityInfoFilterPtr filter,
+    const bool has_cursor,
+    const int limit) {
+  std::string query = GetRecordsSelectQuery();
+  query += GenerateActivityFilterWhereQuery(std::move(filter));
+
+  // Keyset paging, every page is read from the index position of the last
+  // row of the previous page instead of skipping over all previous rows
+  if (has_cursor) {
+    query += " AND (ai.percent < ? OR "
+        "(ai.percent = ? AND ai.publisher_id > ?))";
+  }
+
+  query += " ORDER BY ai.percent DESC, ai.publisher_id ASC";
+  query += " LIMIT " + std::to_string(limit);
+
+  return query;
+}
+
 bool DatabaseActivityInfo::DeleteRecord(
     sql::Database* db,
     const std::string& publisher_key,
@@ -30,11 +30,39 @@ class DatabaseActivityInfo: public DatabaseTable {
       ledger::ActivityInfoFilterPtr filter,
       ledger::PublisherInfoList* list);
 
+  // Reads up to |limit| records which come after |after_percent| and
+  // |after_publisher_key| in the activity list order, highest percent first.
+  // An empty |after_publisher_key| reads the first page. Ordering of |filter|
+  // is ignored
+  bool GetRecordsPage(
+      sql::Database* db,
+      ledger::ActivityInfoFilterPtr filter,
+      const uint32_t after_percent,
+      const std::string& after_publisher_key,
+      const int limit,
+      ledger::PublisherInfoList* list);
+
+  int GetRecordsCount(
+      sql::Database* db,
+      ledger::ActivityInfoFilterPtr filter);
+
   bool DeleteRecord(
       sql::Database* db,
       const std::string& publisher_key,
       const uint64_t reconcile_stamp);
 
+  // Exposed for query plan tests
+  static std::string GetRecordsListQuery(
+      const int start,
+      const int limit,
+      ledger::ActivityInfoFilterPtr filter);
+
+  // Exposed for query plan tests
+  static std::string GetRecordsPageQuery(
+      ledger::ActivityInfoFilterPtr filter,
+      const bool has_cursor,
+      const int limit);
+
  private:
   bool CreateTableV1(sql::Database* db);
 
@@ -56,6 +84,8 @@ class DatabaseActivityInfo: public DatabaseTable {
 
   bool CreateIndexV15(sql::Database* db);
 
+  bool CreateIndexV16(sql::Database* db);
+
   bool MigrateToV1(sql::Database* db);
 
   bool MigrateToV2(sql::Database* db);
@@ -67,6 +97,8 @@ class DatabaseActivityInfo: public DatabaseTable {
   bool MigrateToV6(sql::Database* db);
 
   bool MigrateToV15(sql::Database* db);
+
+  bool MigrateToV16(sql::Database* db);
 };
 
 }  // namespace brave_rewards
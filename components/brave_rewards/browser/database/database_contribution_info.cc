@@ -120,6 +120,21 @@ bool DatabaseContributionInfo::CreateIndexV8(sql::Database* db) {
   return this->InsertIndex(db, table_name_, "publisher_id");
 }
 
+bool DatabaseContributionInfo::CreateIndexV16(sql::Database* db) {
+  // One time tips filter by type and month, reports by month only
+  bool success = this->InsertIndex(
+      db,
+      table_name_,
+      "type_created_at",
+      { "type", "created_at" });
+
+  if (!success) {
+    return false;
+  }
+
+  return this->InsertIndex(db, table_name_, "created_at");
+}
+
 bool DatabaseContributionInfo::Migrate(sql::Database* db, const int target) {
   switch (target) {
     case 2: {
@@ -134,6 +149,9 @@ bool DatabaseContributionInfo::Migrate(sql::Database* db, const int target) {
     case 15: {
       return MigrateToV15(db);
     }
+    case 16: {
+      return MigrateToV16(db);
+    }
     default: {
       NOTREACHED();
       return false;
@@ -176,10 +194,6 @@ bool DatabaseContributionInfo::MigrateToV8(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV8(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "publisher_id", "publisher_id" },
     { "probi", "probi" },
@@ -193,6 +207,10 @@ bool DatabaseContributionInfo::MigrateToV8(sql::Database* db) {
     return false;
   }
 
+  if (!CreateIndexV8(db)) {
+    return false;
+  }
+
   return true;
 }
 
@@ -223,8 +241,27 @@ bool DatabaseContributionInfo::MigrateToV11(sql::Database* db) {
     "SELECT publisher_id, probi, date, type FROM %s",
     temp_table_name.c_str());
 
+  // Migrations run once, so their statements are not kept in the statement
+  // cache for the lifetime of the connection
   sql::Statement statement(db->GetUniqueStatement(query.c_str()));
 
+  const std::string contribution_query = base::StringPrintf(
+    "INSERT INTO %s "
+    "(contribution_id, amount, type, step, "
+    "retry_count, created_at) "
+    "VALUES (?, ?, ?, ?, ?, ?)",
+    table_name_);
+
+  sql::Statement contribution(
+      db->GetUniqueStatement(contribution_query.c_str()));
+
+  const std::string publisher_query =
+    "INSERT INTO contribution_info_publishers "
+    "(contribution_id, publisher_key, total_amount, contributed_amount) "
+    "VALUES (?, ?, ?, ?)";
+
+  sql::Statement publisher(db->GetUniqueStatement(publisher_query.c_str()));
+
   uint32_t count = 0;
   while (statement.Step()) {
     const std::string publisher_key = statement.ColumnString(0);
@@ -236,16 +273,7 @@ bool DatabaseContributionInfo::MigrateToV11(sql::Database* db) {
         std::to_string(date).c_str(),
         std::to_string(count).c_str());
 
-    std::string query = base::StringPrintf(
-      "INSERT INTO %s "
-      "(contribution_id, amount, type, step, "
-      "retry_count, created_at) "
-      "VALUES (?, ?, ?, ?, ?, ?)",
-      table_name_);
-
-    sql::Statement contribution(
-        db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
-
+    contribution.Reset(true);
     contribution.BindString(0, contribution_id);
     contribution.BindDouble(1, amount);
     contribution.BindInt(2, static_cast<int>(type));
@@ -262,14 +290,7 @@ bool DatabaseContributionInfo::MigrateToV11(sql::Database* db) {
       continue;
     }
 
-    query =
-      "INSERT INTO contribution_info_publishers "
-      "(contribution_id, publisher_key, total_amount, contributed_amount) "
-      "VALUES (?, ?, ?, ?)";
-
-    sql::Statement publisher(
-        db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
-
+    publisher.Reset(true);
     publisher.BindString(0, contribution_id);
     publisher.BindString(1, publisher_key);
     publisher.BindDouble(2, amount);
@@ -291,6 +312,10 @@ bool DatabaseContributionInfo::MigrateToV15(sql::Database* db) {
   return publishers_->Migrate(db, 15);
 }
 
+bool DatabaseContributionInfo::MigrateToV16(sql::Database* db) {
+  return CreateIndexV16(db);
+}
+
 bool DatabaseContributionInfo::InsertOrUpdate(
     sql::Database* db,
     ledger::ContributionInfoPtr info) {
@@ -345,26 +370,20 @@ bool DatabaseContributionInfo::GetOneTimeTips(
     return false;
   }
 
-  const std::string query = base::StringPrintf(
-    "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
-    "ci.amount, ci.created_at, spi.status, pi.provider "
-    "FROM %s as ci "
-    "INNER JOIN contribution_info_publishers AS cp "
-    "ON cp.contribution_id = ci.contribution_id "
-    "INNER JOIN publisher_info AS pi ON cp.publisher_key = pi.publisher_id "
-    "LEFT JOIN server_publisher_info AS spi "
-    "ON spi.publisher_key = pi.publisher_id "
-    "WHERE strftime('%%m',  datetime(ci.created_at, 'unixepoch')) = ? AND "
-    "strftime('%%Y', datetime(ci.created_at, 'unixepoch')) = ? AND ci.type = ?",
-    table_name_);
+  int64_t from = 0;
+  int64_t to = 0;
+  if (!GetMonthTimestampRange(static_cast<int>(month), year, &from, &to)) {
+    return false;
+  }
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  const std::string query = GetOneTimeTipsQuery();
 
-  const std::string formatted_month = base::StringPrintf("%02d", month);
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
 
-  statement.BindString(0, formatted_month);
-  statement.BindString(1, std::to_string(year));
-  statement.BindInt(2, static_cast<int>(ledger::RewardsType::ONE_TIME_TIP));
+  statement.BindInt(0, static_cast<int>(ledger::RewardsType::ONE_TIME_TIP));
+  statement.BindInt64(1, from);
+  statement.BindInt64(2, to);
 
   while (statement.Step()) {
     auto publisher = ledger::PublisherInfo::New();
@@ -395,19 +414,19 @@ bool DatabaseContributionInfo::GetContributionReport(
     return false;
   }
 
-  const std::string query = base::StringPrintf(
-    "SELECT ci.contribution_id, ci.amount, ci.type, ci.created_at "
-    "FROM %s as ci "
-    "WHERE strftime('%%m',  datetime(ci.created_at, 'unixepoch')) = ? AND "
-    "strftime('%%Y', datetime(ci.created_at, 'unixepoch')) = ?",
-    table_name_);
+  int64_t from = 0;
+  int64_t to = 0;
+  if (!GetMonthTimestampRange(static_cast<int>(month), year, &from, &to)) {
+    return false;
+  }
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  const std::string query = GetContributionReportQuery();
 
-  const std::string formatted_month = base::StringPrintf("%02d", month);
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
 
-  statement.BindString(0, formatted_month);
-  statement.BindString(1, std::to_string(year));
+  statement.BindInt64(0, from);
+  statement.BindInt64(1, to);
 
   while (statement.Step()) {
     auto report = ledger::ContributionReportInfo::New();
@@ -425,6 +444,30 @@ bool DatabaseContributionInfo::GetContributionReport(
   return true;
 }
 
+// static
+std::string DatabaseContributionInfo::GetOneTimeTipsQuery() {
+  return base::StringPrintf(
+    "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
+    "ci.amount, ci.created_at, spi.status, pi.provider "
+    "FROM %s as ci "
+    "INNER JOIN contribution_info_publishers AS cp "
+    "ON cp.contribution_id = ci.contribution_id "
+    "INNER JOIN publisher_info AS pi ON cp.publisher_key = pi.publisher_id "
+    "LEFT JOIN server_publisher_info AS spi "
+    "ON spi.publisher_key = pi.publisher_id "
+    "WHERE ci.type = ? AND ci.created_at >= ? AND ci.created_at < ?",
+    table_name_);
+}
+
+// static
+std::string DatabaseContributionInfo::GetContributionReportQuery() {
+  return base::StringPrintf(
+    "SELECT ci.contribution_id, ci.amount, ci.type, ci.created_at "
+    "FROM %s as ci "
+    "WHERE ci.created_at >= ? AND ci.created_at < ?",
+    table_name_);
+}
+
 bool DatabaseContributionInfo::GetNotCompletedRecords(
     sql::Database* db,
     ledger::ContributionInfoList* list) {
@@ -438,7 +481,8 @@ bool DatabaseContributionInfo::GetNotCompletedRecords(
     "FROM %s as ci WHERE ci.step > 0",
     table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
 
   while (statement.Step()) {
     auto info = ledger::ContributionInfo::New();
@@ -472,7 +516,8 @@ ledger::ContributionInfoPtr DatabaseContributionInfo::GetRecord(
     "WHERE ci.contribution_id = ?",
     table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
 
   statement.BindString(0, contribution_id);
 
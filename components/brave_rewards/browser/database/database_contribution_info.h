@@ -57,6 +57,11 @@ class DatabaseContributionInfo: public DatabaseTable {
       const std::string& contribution_id,
       const std::string& publisher_key);
 
+  // Exposed for query plan tests
+  static std::string GetOneTimeTipsQuery();
+
+  static std::string GetContributionReportQuery();
+
  private:
   bool CreateTableV2(sql::Database* db);
 
@@ -68,6 +73,8 @@ class DatabaseContributionInfo: public DatabaseTable {
 
   bool CreateIndexV8(sql::Database* db);
 
+  bool CreateIndexV16(sql::Database* db);
+
   bool MigrateToV2(sql::Database* db);
 
   bool MigrateToV8(sql::Database* db);
@@ -76,6 +83,8 @@ class DatabaseContributionInfo: public DatabaseTable {
 
   bool MigrateToV15(sql::Database* db);
 
+  bool MigrateToV16(sql::Database* db);
+
   std::unique_ptr<DatabaseContributionInfoPublishers> publishers_;
 };
 
@@ -132,10 +132,6 @@ bool DatabaseContributionInfoPublishers::MigrateToV15(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV15(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "contribution_id", "contribution_id" },
     { "publisher_key", "publisher_key" },
@@ -147,6 +143,10 @@ bool DatabaseContributionInfoPublishers::MigrateToV15(sql::Database* db) {
     return false;
   }
 
+  if (!CreateIndexV15(db)) {
+    return false;
+  }
+
   return true;
 }
 
@@ -161,10 +161,9 @@ bool DatabaseContributionInfoPublishers::InsertOrUpdate(
     "DELETE FROM %s WHERE contribution_id = ? AND publisher_key = ?",
     table_name_);
 
-  const std::string query_insert = base::StringPrintf(
+  const std::string insert = base::StringPrintf(
     "INSERT INTO %s "
-    "(contribution_id, publisher_key, total_amount, contributed_amount) "
-    "VALUES (?, ?, ?, ?)",
+    "(contribution_id, publisher_key, total_amount, contributed_amount)",
     table_name_);
 
   sql::Transaction transaction(db);
@@ -174,19 +173,30 @@ bool DatabaseContributionInfoPublishers::InsertOrUpdate(
 
   for (const auto& publisher : info->publishers) {
     sql::Statement statement_delete(
-        db->GetUniqueStatement(query_delete.c_str()));
+        db->GetCachedStatement(SQL_FROM_HERE, query_delete.c_str()));
 
     statement_delete.BindString(0, publisher->contribution_id);
     statement_delete.BindString(1, publisher->publisher_key);
     statement_delete.Run();
+  }
+
+  const auto& publishers = info->publishers;
+  const bool success = BatchInsert(
+      db,
+      SQL_FROM_HERE,
+      insert,
+      4,
+      publishers.size(),
+      [&](sql::Statement* statement, size_t row, int index) {
+        statement->BindString(index, publishers[row]->contribution_id);
+        statement->BindString(index + 1, publishers[row]->publisher_key);
+        statement->BindDouble(index + 2, publishers[row]->total_amount);
+        statement->BindDouble(index + 3, publishers[row]->contributed_amount);
+      });
 
-    sql::Statement statement_insert(
-        db->GetUniqueStatement(query_insert.c_str()));
-    statement_insert.BindString(0, publisher->contribution_id);
-    statement_insert.BindString(1, publisher->publisher_key);
-    statement_insert.BindDouble(2, publisher->total_amount);
-    statement_insert.BindDouble(3, publisher->contributed_amount);
-    statement_insert.Run();
+  if (!success) {
+    transaction.Rollback();
+    return false;
   }
 
   return transaction.Commit();
@@ -205,7 +215,8 @@ bool DatabaseContributionInfoPublishers::GetRecords(
     "FROM %s WHERE contribution_id = ?",
     table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
 
   statement.BindString(0, contribution_id);
 
@@ -241,7 +252,8 @@ bool DatabaseContributionInfoPublishers::GetPublisherInfoList(
     "WHERE cip.contribution_id = ?",
     table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   statement.BindString(0, contribution_id);
 
   while (statement.Step()) {
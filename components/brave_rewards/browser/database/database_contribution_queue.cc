@@ -138,7 +138,8 @@ ledger::ContributionQueuePtr DatabaseContributionQueue::GetFirstRecord(
       table_name_,
       GetIdColumnName().c_str());
 
-  sql::Statement statment(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statment(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
 
   if (!statment.Step()) {
     return nullptr;
@@ -172,7 +173,8 @@ bool DatabaseContributionQueue::DeleteRecord(
       table_name_,
       GetIdColumnName().c_str());
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   statement.BindInt64(0, id);
 
   bool success = statement.Run();
@@ -200,7 +202,8 @@ bool DatabaseContributionQueue::DeleteAllRecords(sql::Database* db) {
   }
 
   const std::string query = base::StringPrintf("DELETE FROM %s", table_name_);
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   bool success = statement.Run();
 
   if (!success) {
@@ -118,10 +118,6 @@ bool DatabaseContributionQueuePublishers::MigrateToV15(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV15(db)) {
-    return false;
-  }
-
   const std::string key = base::StringPrintf("%s_id", parent_table_name_);
   const std::map<std::string, std::string> columns = {
     { key, key },
@@ -133,6 +129,10 @@ bool DatabaseContributionQueuePublishers::MigrateToV15(sql::Database* db) {
     return false;
   }
 
+  if (!CreateIndexV15(db)) {
+    return false;
+  }
+
   return true;
 }
 
@@ -143,9 +143,8 @@ bool DatabaseContributionQueuePublishers::InsertOrUpdate(
     return false;
   }
 
-  const std::string query = base::StringPrintf(
-    "INSERT OR REPLACE INTO %s (%s_id, publisher_key, amount_percent) "
-    "VALUES (?, ?, ?)",
+  const std::string insert = base::StringPrintf(
+    "INSERT OR REPLACE INTO %s (%s_id, publisher_key, amount_percent)",
     table_name_,
     parent_table_name_);
 
@@ -154,14 +153,22 @@ bool DatabaseContributionQueuePublishers::InsertOrUpdate(
     return false;
   }
 
-  for (const auto& publisher : info->publishers) {
-    sql::Statement statement(
-      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
+  const auto& publishers = info->publishers;
+  const bool success = BatchInsert(
+      db,
+      SQL_FROM_HERE,
+      insert,
+      3,
+      publishers.size(),
+      [&](sql::Statement* statement, size_t row, int index) {
+        statement->BindInt64(index, info->id);
+        statement->BindString(index + 1, publishers[row]->publisher_key);
+        statement->BindDouble(index + 2, publishers[row]->amount_percent);
+      });
 
-    statement.BindInt64(0, info->id);
-    statement.BindString(1, publisher->publisher_key);
-    statement.BindDouble(2, publisher->amount_percent);
-    statement.Run();
+  if (!success) {
+    transaction.Rollback();
+    return false;
   }
 
   return transaction.Commit();
@@ -178,7 +185,8 @@ DatabaseContributionQueuePublishers::GetRecords(
       table_name_,
       parent_table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   statement.BindInt64(0, queue_id);
 
   while (statement.Step()) {
@@ -206,7 +214,8 @@ bool DatabaseContributionQueuePublishers::DeleteRecordsByQueueId(
       table_name_,
       parent_table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   statement.BindInt64(0, queue_id);
 
   return statement.Run();
@@ -219,7 +228,8 @@ bool DatabaseContributionQueuePublishers::DeleteAllRecords(sql::Database* db) {
   }
 
   const std::string query = base::StringPrintf("DELETE FROM %s", table_name_);
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   return statement.Run();
 }
 
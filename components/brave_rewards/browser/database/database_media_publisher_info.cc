@@ -105,10 +105,6 @@ bool DatabaseMediaPublisherInfo::MigrateToV15(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV15(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "media_key", "media_key" },
     { "publisher_id", "publisher_id" }
@@ -118,6 +114,10 @@ bool DatabaseMediaPublisherInfo::MigrateToV15(sql::Database* db) {
     return false;
   }
 
+  if (!CreateIndexV15(db)) {
+    return false;
+  }
+
   return true;
 }
 
@@ -159,7 +159,8 @@ ledger::PublisherInfoPtr DatabaseMediaPublisherInfo::GetRecord(
       "WHERE mpi.media_key=?",
       table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
 
   statement.BindString(0, media_key);
 
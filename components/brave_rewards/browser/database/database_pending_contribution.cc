@@ -172,10 +172,6 @@ bool DatabasePendingContribution::MigrateToV8(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV8(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "publisher_id", "publisher_id" },
     { "amount", "amount" },
@@ -188,6 +184,10 @@ bool DatabasePendingContribution::MigrateToV8(sql::Database* db) {
     return false;
   }
 
+  if (!CreateIndexV8(db)) {
+    return false;
+  }
+
   return true;
 }
 
@@ -210,10 +210,6 @@ bool DatabasePendingContribution::MigrateToV12(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV12(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "publisher_id", "publisher_id" },
     { "amount", "amount" },
@@ -225,6 +221,11 @@ bool DatabasePendingContribution::MigrateToV12(sql::Database* db) {
   if (!MigrateDBTable(db, temp_table_name, table_name_, columns, true)) {
     return false;
   }
+
+  if (!CreateIndexV12(db)) {
+    return false;
+  }
+
   return true;
 }
 
@@ -247,10 +248,6 @@ bool DatabasePendingContribution::MigrateToV15(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV15(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "pending_contribution_id", "pending_contribution_id" },
     { "publisher_id", "publisher_id" },
@@ -263,6 +260,10 @@ bool DatabasePendingContribution::MigrateToV15(sql::Database* db) {
   if (!MigrateDBTable(db, temp_table_name, table_name_, columns, true)) {
     return false;
   }
+
+  if (!CreateIndexV15(db)) {
+    return false;
+  }
   return true;
 }
 
@@ -280,24 +281,28 @@ bool DatabasePendingContribution::InsertOrUpdate(
 
   const uint64_t now = static_cast<uint64_t>(base::Time::Now().ToDoubleT());
 
-  const std::string query = base::StringPrintf(
+  const std::string insert = base::StringPrintf(
     "INSERT INTO %s (pending_contribution_id, publisher_id, amount, "
-    "added_date, viewing_id, type) VALUES (?, ?, ?, ?, ?, ?)",
+    "added_date, viewing_id, type)",
     table_name_);
 
-  for (const auto& item : list) {
-    sql::Statement statement(
-        db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
-
-    statement.BindNull(0);
-    statement.BindString(1, item->publisher_key);
-    statement.BindDouble(2, item->amount);
-    statement.BindInt64(3, now);
-    statement.BindString(4, item->viewing_id);
-    statement.BindInt(5, static_cast<int>(item->type));
-    if (!statement.Run()) {
-      return false;
-    }
+  const bool success = BatchInsert(
+      db,
+      SQL_FROM_HERE,
+      insert,
+      6,
+      list.size(),
+      [&](sql::Statement* statement, size_t row, int index) {
+        statement->BindNull(index);
+        statement->BindString(index + 1, list[row]->publisher_key);
+        statement->BindDouble(index + 2, list[row]->amount);
+        statement->BindInt64(index + 3, now);
+        statement->BindString(index + 4, list[row]->viewing_id);
+        statement->BindInt(index + 5, static_cast<int>(list[row]->type));
+      });
+
+  if (!success) {
+    return false;
   }
 
   return transaction.Commit();
@@ -308,7 +313,8 @@ double DatabasePendingContribution::GetReservedAmount(sql::Database *db) {
     "SELECT SUM(amount) FROM %s",
     table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
 
   double amount = 0.0;
 
@@ -326,17 +332,10 @@ void DatabasePendingContribution::GetAllRecords(
     return;
   }
 
-  const std::string query = base::StringPrintf(
-    "SELECT pc.pending_contribution_id, pi.publisher_id, pi.name, "
-    "pi.url, pi.favIcon, spi.status, pi.provider, pc.amount, pc.added_date, "
-    "pc.viewing_id, pc.type "
-    "FROM %s as pc "
-    "INNER JOIN publisher_info AS pi ON pc.publisher_id = pi.publisher_id "
-    "LEFT JOIN server_publisher_info AS spi "
-    "ON spi.publisher_key = pi.publisher_id",
-    table_name_);
+  const std::string query = GetAllRecordsQuery();
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
 
   while (statement.Step()) {
     auto info = ledger::PendingContributionInfo::New();
@@ -383,4 +382,17 @@ bool DatabasePendingContribution::DeleteAllRecords(sql::Database* db) {
   return statement.Run();
 }
 
+// static
+std::string DatabasePendingContribution::GetAllRecordsQuery() {
+  return base::StringPrintf(
+    "SELECT pc.pending_contribution_id, pi.publisher_id, pi.name, "
+    "pi.url, pi.favIcon, spi.status, pi.provider, pc.amount, pc.added_date, "
+    "pc.viewing_id, pc.type "
+    "FROM %s as pc "
+    "INNER JOIN publisher_info AS pi ON pc.publisher_id = pi.publisher_id "
+    "LEFT JOIN server_publisher_info AS spi "
+    "ON spi.publisher_key = pi.publisher_id",
+    table_name_);
+}
+
 }  // namespace brave_rewards
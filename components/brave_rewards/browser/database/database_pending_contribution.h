@@ -35,6 +35,9 @@ class DatabasePendingContribution: public DatabaseTable {
 
   bool DeleteAllRecords(sql::Database* db);
 
+  // Exposed for query plan tests
+  static std::string GetAllRecordsQuery();
+
  private:
   bool CreateTableV3(sql::Database* db);
 
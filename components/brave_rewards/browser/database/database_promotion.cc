@@ -135,7 +135,7 @@ bool DatabasePromotion::MigrateToV13(sql::Database* db) {
         column);
 
     sql::Statement statement(
-        db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
+        db->GetUniqueStatement(query.c_str()));
 
     return statement.Run();
   }
@@ -158,7 +158,7 @@ bool DatabasePromotion::MigrateToV14(sql::Database* db) {
       table_name_);
 
   sql::Statement statement(
-    db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
+    db->GetUniqueStatement(query.c_str()));
 
   return statement.Run();
 }
@@ -232,7 +232,8 @@ ledger::PromotionPtr DatabasePromotion::GetRecord(
       table_name_,
       table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   statement.BindString(0, id);
 
   if (!statement.Step()) {
@@ -261,7 +262,8 @@ ledger::PromotionMap DatabasePromotion::GetAllRecords(sql::Database* db) {
       table_name_,
       table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
 
   ledger::PromotionMap map;
 
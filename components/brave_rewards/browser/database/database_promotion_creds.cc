@@ -130,10 +130,6 @@ bool DatabasePromotionCreds::MigrateToV15(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV15(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "promotion_id", "promotion_id" },
     { "tokens", "tokens" },
@@ -147,6 +143,10 @@ bool DatabasePromotionCreds::MigrateToV15(sql::Database* db) {
   if (!MigrateDBTable(db, temp_table_name, table_name_, columns, true)) {
     return false;
   }
+
+  if (!CreateIndexV15(db)) {
+    return false;
+  }
   return true;
 }
 
@@ -202,7 +202,8 @@ ledger::PromotionCredsPtr DatabasePromotionCreds::GetRecord(
       table_name_,
       parent_table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   statement.BindString(0, promotion_id);
 
   if (!statement.Step()) {
@@ -58,6 +58,10 @@ bool DatabasePublisherInfo::CreateTableV7(sql::Database* db) {
   return db->Execute(query.c_str());
 }
 
+bool DatabasePublisherInfo::CreateIndexV16(sql::Database* db) {
+  return this->InsertIndex(db, table_name_, "excluded");
+}
+
 bool DatabasePublisherInfo::Migrate(sql::Database* db, const int target) {
   switch (target) {
     case 1: {
@@ -66,6 +70,9 @@ bool DatabasePublisherInfo::Migrate(sql::Database* db, const int target) {
     case 7: {
       return MigrateToV7(db);
     }
+    case 16: {
+      return MigrateToV16(db);
+    }
     default: {
       NOTREACHED();
       return false;
@@ -114,6 +121,10 @@ bool DatabasePublisherInfo::MigrateToV7(sql::Database* db) {
   return true;
 }
 
+bool DatabasePublisherInfo::MigrateToV16(sql::Database* db) {
+  return CreateIndexV16(db);
+}
+
 bool DatabasePublisherInfo::InsertOrUpdate(
     sql::Database* db,
     ledger::PublisherInfoPtr info) {
@@ -188,7 +199,8 @@ ledger::PublisherInfoPtr DatabasePublisherInfo::GetRecord(
     "WHERE publisher_id=?",
     table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   statement.BindString(0, publisher_key);
 
   if (!statement.Step()) {
@@ -216,20 +228,10 @@ ledger::PublisherInfoPtr DatabasePublisherInfo::GetPanelRecord(
     return nullptr;
   }
 
-  const std::string query = base::StringPrintf(
-    "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
-    "pi.provider, spi.status, pi.excluded, "
-    "("
-    "  SELECT IFNULL(percent, 0) FROM activity_info WHERE "
-    "  publisher_id = ? AND reconcile_stamp = ? "
-    ") as percent "
-    "FROM %s AS pi "
-    "LEFT JOIN server_publisher_info AS spi "
-    "ON spi.publisher_key = pi.publisher_id "
-    "WHERE pi.publisher_id = ? LIMIT 1",
-    table_name_);
+  const std::string query = GetPanelRecordQuery();
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   statement.BindString(0, filter->id);
   statement.BindInt64(1, filter->reconcile_stamp);
   statement.BindString(2, filter->id);
@@ -274,16 +276,10 @@ bool DatabasePublisherInfo::GetExcludedList(
     return false;
   }
 
-  const std::string query = base::StringPrintf(
-    "SELECT pi.publisher_id, spi.status, pi.name,"
-    "pi.favicon, pi.url, pi.provider "
-    "FROM %s as pi "
-    "LEFT JOIN server_publisher_info AS spi "
-    "ON spi.publisher_key = pi.publisher_id "
-    "WHERE pi.excluded = 1",
-    table_name_);
+  const std::string query = GetExcludedListQuery();
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
 
   while (statement.Step()) {
     auto info = ledger::PublisherInfo::New();
@@ -301,4 +297,32 @@ bool DatabasePublisherInfo::GetExcludedList(
   return true;
 }
 
+// static
+std::string DatabasePublisherInfo::GetPanelRecordQuery() {
+  return base::StringPrintf(
+    "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
+    "pi.provider, spi.status, pi.excluded, "
+    "("
+    "  SELECT IFNULL(percent, 0) FROM activity_info WHERE "
+    "  publisher_id = ? AND reconcile_stamp = ? "
+    ") as percent "
+    "FROM %s AS pi "
+    "LEFT JOIN server_publisher_info AS spi "
+    "ON spi.publisher_key = pi.publisher_id "
+    "WHERE pi.publisher_id = ? LIMIT 1",
+    table_name_);
+}
+
+// static
+std::string DatabasePublisherInfo::GetExcludedListQuery() {
+  return base::StringPrintf(
+    "SELECT pi.publisher_id, spi.status, pi.name,"
+    "pi.favicon, pi.url, pi.provider "
+    "FROM %s as pi "
+    "LEFT JOIN server_publisher_info AS spi "
+    "ON spi.publisher_key = pi.publisher_id "
+    "WHERE pi.excluded = 1",
+    table_name_);
+}
+
 }  // namespace brave_rewards
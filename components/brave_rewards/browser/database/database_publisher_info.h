@@ -35,14 +35,23 @@ class DatabasePublisherInfo: public DatabaseTable {
 
   bool GetExcludedList(sql::Database* db, ledger::PublisherInfoList* list);
 
+  // Exposed for query plan tests
+  static std::string GetPanelRecordQuery();
+
+  static std::string GetExcludedListQuery();
+
  private:
   bool CreateTableV1(sql::Database* db);
 
   bool CreateTableV7(sql::Database* db);
 
+  bool CreateIndexV16(sql::Database* db);
+
   bool MigrateToV1(sql::Database* db);
 
   bool MigrateToV7(sql::Database* db);
+
+  bool MigrateToV16(sql::Database* db);
 };
 
 }  // namespace brave_rewards
@@ -115,10 +115,6 @@ bool DatabaseRecurringTip::MigrateToV15(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV15(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "publisher_id", "publisher_id" },
     { "amount", "amount" },
@@ -128,6 +124,10 @@ bool DatabaseRecurringTip::MigrateToV15(sql::Database* db) {
   if (!MigrateDBTable(db, temp_table_name, table_name_, columns, true)) {
     return false;
   }
+
+  if (!CreateIndexV15(db)) {
+    return false;
+  }
   return true;
 }
 
@@ -161,16 +161,10 @@ void DatabaseRecurringTip::GetAllRecords(
     return;
   }
 
-  const std::string query = base::StringPrintf(
-    "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
-    "rd.amount, rd.added_date, spi.status, pi.provider "
-    "FROM %s as rd "
-    "INNER JOIN publisher_info AS pi ON rd.publisher_id = pi.publisher_id "
-    "LEFT JOIN server_publisher_info AS spi "
-    "ON spi.publisher_key = pi.publisher_id ",
-    table_name_);
+  const std::string query = GetAllRecordsQuery();
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
 
   while (statement.Step()) {
     auto publisher = ledger::PublisherInfo::New();
@@ -203,4 +197,16 @@ bool DatabaseRecurringTip::DeleteRecord(
   return statement.Run();
 }
 
+// static
+std::string DatabaseRecurringTip::GetAllRecordsQuery() {
+  return base::StringPrintf(
+    "SELECT pi.publisher_id, pi.name, pi.url, pi.favIcon, "
+    "rd.amount, rd.added_date, spi.status, pi.provider "
+    "FROM %s as rd "
+    "INNER JOIN publisher_info AS pi ON rd.publisher_id = pi.publisher_id "
+    "LEFT JOIN server_publisher_info AS spi "
+    "ON spi.publisher_key = pi.publisher_id ",
+    table_name_);
+}
+
 }  // namespace brave_rewards
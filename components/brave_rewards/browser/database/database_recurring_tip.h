@@ -29,6 +29,9 @@ class DatabaseRecurringTip: public DatabaseTable {
 
   bool DeleteRecord(sql::Database* db, const std::string& publisher_key);
 
+  // Exposed for query plan tests
+  static std::string GetAllRecordsQuery();
+
  private:
   bool CreateTableV2(sql::Database* db);
 
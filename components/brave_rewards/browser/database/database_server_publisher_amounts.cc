@@ -120,10 +120,6 @@ bool DatabaseServerPublisherAmounts::MigrateToV15(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV15(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "publisher_key", "publisher_key" },
     { "amount", "amount" }
@@ -132,6 +128,10 @@ bool DatabaseServerPublisherAmounts::MigrateToV15(sql::Database* db) {
   if (!MigrateDBTable(db, temp_table_name, table_name_, columns, true)) {
     return false;
   }
+
+  if (!CreateIndexV15(db)) {
+    return false;
+  }
   return true;
 }
 
@@ -152,19 +152,25 @@ bool DatabaseServerPublisherAmounts::InsertOrUpdate(
     return false;
   }
 
-  for (const auto& amount : info->banner->amounts) {
-    const std::string query = base::StringPrintf(
-      "INSERT OR REPLACE INTO %s "
-      "(publisher_key, amount) "
-      "VALUES (?, ?)",
+  const std::string insert = base::StringPrintf(
+      "INSERT OR REPLACE INTO %s (publisher_key, amount)",
       table_name_);
 
-    sql::Statement statment(
-        db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
-
-    statment.BindString(0, info->publisher_key);
-    statment.BindDouble(1, amount);
-    statment.Run();
+  const auto& amounts = info->banner->amounts;
+  const bool success = BatchInsert(
+      db,
+      SQL_FROM_HERE,
+      insert,
+      2,
+      amounts.size(),
+      [&](sql::Statement* statement, size_t row, int index) {
+        statement->BindString(index, info->publisher_key);
+        statement->BindDouble(index + 1, amounts[row]);
+      });
+
+  if (!success) {
+    transaction.Rollback();
+    return false;
   }
 
   return transaction.Commit();
@@ -177,7 +183,8 @@ std::vector<double> DatabaseServerPublisherAmounts::GetRecord(
       "SELECT amount FROM %s WHERE publisher_key=?",
       table_name_);
 
-  sql::Statement statment(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statment(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   statment.BindString(0, publisher_key);
 
   std::vector<double> amounts;
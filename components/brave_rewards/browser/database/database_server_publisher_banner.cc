@@ -132,10 +132,6 @@ bool DatabaseServerPublisherBanner::MigrateToV15(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV15(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "publisher_key", "publisher_key" },
     { "title", "title" },
@@ -148,6 +144,10 @@ bool DatabaseServerPublisherBanner::MigrateToV15(sql::Database* db) {
     return false;
   }
 
+  if (!CreateIndexV15(db)) {
+    return false;
+  }
+
   if (!links_->Migrate(db, 15)) {
     return false;
   }
@@ -212,7 +212,8 @@ ledger::PublisherBannerPtr DatabaseServerPublisherBanner::GetRecord(
       "WHERE publisher_key=?",
       table_name_);
 
-  sql::Statement statment(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statment(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   statment.BindString(0, publisher_key);
 
   if (!statment.Step()) {
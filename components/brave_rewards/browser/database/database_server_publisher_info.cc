@@ -4,6 +4,7 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include <utility>
+#include <vector>
 
 #include "base/bind.h"
 #include "base/strings/stringprintf.h"
@@ -132,16 +133,38 @@ bool DatabaseServerPublisherInfo::ClearAndInsertList(
     return false;
   }
 
+  std::vector<const ledger::ServerPublisherInfo*> rows;
+  rows.reserve(list.size());
   for (const auto& info : list) {
-    if (!info) {
-      continue;
+    if (info) {
+      rows.push_back(info.get());
     }
+  }
 
-    if (!InsertOrUpdate(db, info->Clone())) {
-      transaction.Rollback();
-      return false;
-    }
+  const std::string insert = base::StringPrintf(
+      "INSERT OR REPLACE INTO %s "
+      "(publisher_key, status, excluded, address)",
+      table_name_);
+
+  const bool success = BatchInsert(
+      db,
+      SQL_FROM_HERE,
+      insert,
+      4,
+      rows.size(),
+      [&](sql::Statement* statement, size_t row, int index) {
+        statement->BindString(index, rows[row]->publisher_key);
+        statement->BindInt(index + 1, static_cast<int>(rows[row]->status));
+        statement->BindBool(index + 2, rows[row]->excluded);
+        statement->BindString(index + 3, rows[row]->address);
+      });
 
+  if (!success) {
+    transaction.Rollback();
+    return false;
+  }
+
+  for (const auto* info : rows) {
     if (info->banner) {
       if (!banner_->InsertOrUpdate(db, info->Clone())) {
         transaction.Rollback();
@@ -162,7 +185,8 @@ ledger::ServerPublisherInfoPtr DatabaseServerPublisherInfo::GetRecord(
       "WHERE publisher_key=?",
       table_name_);
 
-  sql::Statement statment(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statment(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   statment.BindString(0, publisher_key);
 
   if (!statment.Step()) {
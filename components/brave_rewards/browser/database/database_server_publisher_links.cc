@@ -5,6 +5,7 @@
 
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "base/bind.h"
 #include "base/strings/stringprintf.h"
@@ -123,10 +124,6 @@ bool DatabaseServerPublisherLinks::MigrateToV15(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV15(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "publisher_key", "publisher_key" },
     { "provider", "provider" },
@@ -137,6 +134,10 @@ bool DatabaseServerPublisherLinks::MigrateToV15(sql::Database* db) {
     return false;
   }
 
+  if (!CreateIndexV15(db)) {
+    return false;
+  }
+
   return true;
 }
 
@@ -157,24 +158,34 @@ bool DatabaseServerPublisherLinks::InsertOrUpdate(
     return false;
   }
 
+  std::vector<std::pair<std::string, std::string>> links;
   for (const auto& link : info->banner->links) {
     if (link.second.empty()) {
       continue;
     }
 
-    const std::string query = base::StringPrintf(
-      "INSERT OR REPLACE INTO %s "
-      "(publisher_key, provider, link) "
-      "VALUES (?, ?, ?)",
-      table_name_);
+    links.push_back(link);
+  }
 
-    sql::Statement statment(
-        db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
+  const std::string insert = base::StringPrintf(
+      "INSERT OR REPLACE INTO %s (publisher_key, provider, link)",
+      table_name_);
 
-    statment.BindString(0, info->publisher_key);
-    statment.BindString(1, link.first);
-    statment.BindString(2, link.second);
-    statment.Run();
+  const bool success = BatchInsert(
+      db,
+      SQL_FROM_HERE,
+      insert,
+      3,
+      links.size(),
+      [&](sql::Statement* statement, size_t row, int index) {
+        statement->BindString(index, info->publisher_key);
+        statement->BindString(index + 1, links[row].first);
+        statement->BindString(index + 2, links[row].second);
+      });
+
+  if (!success) {
+    transaction.Rollback();
+    return false;
   }
 
   return transaction.Commit();
@@ -188,7 +199,8 @@ DatabaseServerPublisherLinks::GetRecord(
       "SELECT provider, link FROM %s WHERE publisher_key=?",
       table_name_);
 
-  sql::Statement statment(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statment(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
   statment.BindString(0, publisher_key);
 
   base::flat_map<std::string, std::string> links;
@@ -3,6 +3,7 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "brave/components/brave_rewards/browser/database/database_table.h"
 
@@ -29,6 +30,22 @@ bool DatabaseTable::InsertIndex(
   return db->Execute(query.c_str());
 }
 
+bool DatabaseTable::InsertIndex(
+    sql::Database* db,
+    const std::string& table_name,
+    const std::string& name,
+    const std::vector<std::string>& keys) {
+  DCHECK(!keys.empty());
+  const std::string query = base::StringPrintf(
+      "CREATE INDEX %s_%s_index ON %s (%s)",
+      table_name.c_str(),
+      name.c_str(),
+      table_name.c_str(),
+      base::JoinString(keys, ", ").c_str());
+
+  return db->Execute(query.c_str());
+}
+
 int DatabaseTable::GetCurrentDBVersion() {
   return current_db_version_;
 }
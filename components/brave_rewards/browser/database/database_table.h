@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_DATABASE_DATABASE_TABLE_H_
 
 #include <string>
+#include <vector>
 
 #include "sql/database.h"
 
@@ -25,6 +26,13 @@ class DatabaseTable {
     const std::string& table_name,
     const std::string& key);
 
+  // Creates |table_name|_|name|_index over |keys| in the given order
+  bool InsertIndex(
+    sql::Database* db,
+    const std::string& table_name,
+    const std::string& name,
+    const std::vector<std::string>& keys);
+
   int GetCurrentDBVersion();
 
  private:
@@ -126,7 +126,7 @@ bool DatabaseUnblindedToken::MigrateToV14(sql::Database* db) {
       table_name_);
 
   sql::Statement statement(
-    db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
+    db->GetUniqueStatement(query.c_str()));
 
   return statement.Run();
 }
@@ -150,10 +150,6 @@ bool DatabaseUnblindedToken::MigrateToV15(sql::Database* db) {
     return false;
   }
 
-  if (!CreateIndexV15(db)) {
-    return false;
-  }
-
   const std::map<std::string, std::string> columns = {
     { "token_id", "token_id" },
     { "token_value", "token_value" },
@@ -167,6 +163,10 @@ bool DatabaseUnblindedToken::MigrateToV15(sql::Database* db) {
     return false;
   }
 
+  if (!CreateIndexV15(db)) {
+    return false;
+  }
+
   return true;
 }
 
@@ -219,7 +219,8 @@ ledger::UnblindedTokenList DatabaseUnblindedToken::GetAllRecords(
       "LEFT JOIN promotion as p ON p.promotion_id = u.promotion_id",
       table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
 
   while (statement.Step()) {
     auto info = ledger::UnblindedToken::New();
@@ -263,11 +264,12 @@ bool DatabaseUnblindedToken::DeleteRecordsForPromotion(
   }
 
   const std::string query = base::StringPrintf(
-      "DELETE FROM %s WHERE promotion_id = '%s'",
-      table_name_,
-      promotion_id.c_str());
+      "DELETE FROM %s WHERE promotion_id = ?",
+      table_name_);
 
-  sql::Statement statement(db->GetUniqueStatement(query.c_str()));
+  sql::Statement statement(
+      db->GetCachedStatement(SQL_FROM_HERE, query.c_str()));
+  statement.BindString(0, promotion_id);
 
   return statement.Run();
 }
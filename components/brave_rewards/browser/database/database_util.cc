@@ -5,6 +5,7 @@
 
 #include "base/strings/stringprintf.h"
 #include "base/strings/string_util.h"
+#include "base/time/time.h"
 #include "brave/components/brave_rewards/browser/database/database_util.h"
 
 namespace brave_rewards {
@@ -94,6 +95,70 @@ bool MigrateDBTable(
   return MigrateDBTable(db, from, to, new_columns, should_drop, group_by);
 }
 
+bool GetMonthTimestampRange(
+    const int month,
+    const int year,
+    int64_t* from,
+    int64_t* to) {
+  DCHECK(from && to);
+  if (!from || !to || month < 1 || month > 12) {
+    return false;
+  }
+
+  base::Time::Exploded exploded = {};
+  exploded.year = year;
+  exploded.month = month;
+  exploded.day_of_month = 1;
+
+  base::Time start;
+  if (!base::Time::FromUTCExploded(exploded, &start)) {
+    return false;
+  }
+
+  if (month == 12) {
+    exploded.year++;
+    exploded.month = 1;
+  } else {
+    exploded.month++;
+  }
+
+  base::Time end;
+  if (!base::Time::FromUTCExploded(exploded, &end)) {
+    return false;
+  }
+
+  *from = start.ToTimeT();
+  *to = end.ToTimeT();
+  return true;
+}
+
+std::string GenerateBatchInsertQuery(
+    const std::string& insert,
+    const size_t column_count,
+    const size_t row_count) {
+  DCHECK_GT(column_count, 0UL);
+  DCHECK_GT(row_count, 0UL);
+
+  std::vector<std::string> placeholders(column_count, "?");
+  const std::string group =
+      base::StringPrintf("(%s)", base::JoinString(placeholders, ",").c_str());
+
+  std::vector<std::string> groups(row_count, group);
+  return base::StringPrintf(
+      "%s VALUES %s",
+      insert.c_str(),
+      base::JoinString(groups, ",").c_str());
+}
+
+size_t GetBatchInsertRowLimit(const size_t column_count) {
+  DCHECK_GT(column_count, 0UL);
+  if (column_count == 0) {
+    return 1;
+  }
+
+  return std::max<size_t>(1, kMaxBoundParameters / column_count);
+}
+
 bool RenameDBTable(
     sql::Database* db,
     const std::string& from,
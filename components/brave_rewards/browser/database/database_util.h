@@ -6,11 +6,17 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_DATABASE_DATABASE_UTIL_H_
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_DATABASE_DATABASE_UTIL_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
 #include <map>
 #include <string>
 #include <vector>
 
+#include "base/logging.h"
 #include "sql/database.h"
+#include "sql/statement.h"
 
 namespace brave_rewards {
 
@@ -46,6 +52,74 @@ bool DropTable(
     sql::Database* db,
     const std::string& table_name);
 
+// Returns unix timestamps bounding |month| (1-12) of |year| in UTC, with
+// |to| exclusive, so month filters can be answered from an index on a
+// timestamp column
+bool GetMonthTimestampRange(
+    const int month,
+    const int year,
+    int64_t* from,
+    int64_t* to);
+
+// SQLite rejects statements with more bound parameters than this
+// (SQLITE_MAX_VARIABLE_NUMBER)
+const size_t kMaxBoundParameters = 999;
+
+// Appends |row_count| placeholder groups of |column_count| parameters to
+// |insert|, e.g. "INSERT INTO t (a, b)" becomes
+// "INSERT INTO t (a, b) VALUES (?,?),(?,?)"
+std::string GenerateBatchInsertQuery(
+    const std::string& insert,
+    const size_t column_count,
+    const size_t row_count);
+
+size_t GetBatchInsertRowLimit(const size_t column_count);
+
+// Inserts |row_count| rows with as few multi-row statements as the bound
+// parameter limit allows. |bind_row| is invoked as
+// bind_row(statement, row_index, first_parameter_index) for every row.
+// Full-size chunks always produce the same SQL so they are served from the
+// statement cache under |id|; only the trailing chunk is prepared once.
+// Callers are expected to hold a transaction.
+template <typename BindRowFunction>
+bool BatchInsert(
+    sql::Database* db,
+    sql::StatementID id,
+    const std::string& insert,
+    const size_t column_count,
+    const size_t row_count,
+    BindRowFunction bind_row) {
+  DCHECK(db);
+  DCHECK_GT(column_count, 0UL);
+  if (!db) {
+    return false;
+  }
+
+  const size_t row_limit = GetBatchInsertRowLimit(column_count);
+  size_t row = 0;
+  while (row < row_count) {
+    const size_t chunk_size = std::min(row_limit, row_count - row);
+    const std::string query =
+        GenerateBatchInsertQuery(insert, column_count, chunk_size);
+
+    sql::Statement statement(chunk_size == row_limit
+        ? db->GetCachedStatement(id, query.c_str())
+        : db->GetUniqueStatement(query.c_str()));
+
+    for (size_t i = 0; i < chunk_size; i++) {
+      bind_row(&statement, row + i, static_cast<int>(i * column_count));
+    }
+
+    if (!statement.Run()) {
+      return false;
+    }
+
+    row += chunk_size;
+  }
+
+  return true;
+}
+
 }  // namespace brave_rewards
 
 #endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_DATABASE_DATABASE_UTIL_H_
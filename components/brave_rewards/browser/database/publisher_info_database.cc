@@ -3,6 +3,8 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <inttypes.h>
+
 #include <utility>
 
 #include "bat/ledger/global_constants.h"
@@ -11,6 +13,7 @@
 #include "base/files/file_util.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/string_util.h"
+#include "base/timer/elapsed_timer.h"
 #include "build/build_config.h"
 #include "sql/meta_table.h"
 #include "sql/statement.h"
@@ -24,7 +27,7 @@ namespace brave_rewards {
 
 namespace {
 
-const int kCurrentVersionNumber = 15;
+const int kCurrentVersionNumber = 16;
 const int kCompatibleVersionNumber = 1;
 
 
@@ -50,7 +53,8 @@ PublisherInfoDatabase::PublisherInfoDatabase(
     const int testing_current_version) :
     db_path_(db_path),
     initialized_(false),
-    testing_current_version_(testing_current_version) {
+    testing_current_version_(testing_current_version),
+    read_only_(false) {
   DETACH_FROM_SEQUENCE(sequence_checker_);
 
   server_publisher_info_ =
@@ -94,29 +98,49 @@ bool PublisherInfoDatabase::Init() {
     return true;
   }
 
+  if (tuning_.page_size > 0) {
+    db_.set_page_size(tuning_.page_size);
+  }
+
+  if (tuning_.cache_size > 0) {
+    db_.set_cache_size(tuning_.cache_size);
+  }
+
   if (!db_.Open(db_path_)) {
     return false;
   }
 
-  // TODO(brave): Add error delegate
-  sql::Transaction committer(&GetDB());
-  if (!committer.Begin()) {
+  if (!ApplyTuning()) {
     return false;
   }
 
-  int table_version = 0;
-  if (GetMetaTable().DoesTableExist(&GetDB())) {
-    if (!InitMetaTable(GetCurrentVersion())) {
-      return false;
-    }
+  if (!read_only_) {
+    // TODO(brave): Add error delegate
+    int table_version = 0;
+    {
+      sql::Transaction committer(&GetDB());
+      if (!committer.Begin()) {
+        return false;
+      }
 
-    table_version = GetTableVersionNumber();
-  }
+      if (GetMetaTable().DoesTableExist(&GetDB())) {
+        if (!InitMetaTable(GetCurrentVersion())) {
+          return false;
+        }
 
-  // Version check.
-  sql::InitStatus version_status = EnsureCurrentVersion(table_version);
-  if (version_status != sql::INIT_OK || !committer.Commit()) {
-    return false;
+        table_version = GetTableVersionNumber();
+      }
+
+      if (!committer.Commit()) {
+        return false;
+      }
+    }
+
+    // Version check. Commits once per migrated version.
+    sql::InitStatus version_status = EnsureCurrentVersion(table_version);
+    if (version_status != sql::INIT_OK) {
+      return false;
+    }
   }
 
   memory_pressure_listener_.reset(new base::MemoryPressureListener(
@@ -322,6 +346,34 @@ bool PublisherInfoDatabase::GetActivityList(
       list);
 }
 
+bool PublisherInfoDatabase::GetActivityListPage(
+    ledger::ActivityInfoFilterPtr filter,
+    const uint32_t after_percent,
+    const std::string& after_publisher_key,
+    const int limit,
+    ledger::PublisherInfoList* list) {
+  if (!IsInitialized()) {
+    return false;
+  }
+
+  return activity_info_->GetRecordsPage(
+      &GetDB(),
+      std::move(filter),
+      after_percent,
+      after_publisher_key,
+      limit,
+      list);
+}
+
+int PublisherInfoDatabase::GetActivityListCount(
+    ledger::ActivityInfoFilterPtr filter) {
+  if (!IsInitialized()) {
+    return 0;
+  }
+
+  return activity_info_->GetRecordsCount(&GetDB(), std::move(filter));
+}
+
 bool PublisherInfoDatabase::DeleteActivityInfo(
     const std::string& publisher_key,
     uint64_t reconcile_stamp) {
@@ -650,7 +702,8 @@ void PublisherInfoDatabase::RecordP3AStats(bool auto_contributions_on) {
   if (queued_recurring == 0) {
     // Check for queued recurring donations.
     sql::Statement sql(
-        db_.GetUniqueStatement("SELECT COUNT(*) FROM recurring_donation"));
+        db_.GetCachedStatement(SQL_FROM_HERE,
+            "SELECT COUNT(*) FROM recurring_donation"));
     if (sql.Step()) {
       queued_recurring = sql.ColumnInt(0);
     }
@@ -682,6 +735,20 @@ void PublisherInfoDatabase::Vacuum() {
   ignore_result(db_.Execute("VACUUM"));
 }
 
+void PublisherInfoDatabase::RunMaintenance() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (!initialized_ || read_only_ || db_.transaction_nesting() > 0) {
+    return;
+  }
+
+  if (tuning_.wal_mode) {
+    ignore_result(db_.Execute("PRAGMA wal_checkpoint(PASSIVE)"));
+  }
+
+  ignore_result(db_.Execute("PRAGMA optimize"));
+}
+
 void PublisherInfoDatabase::OnMemoryPressure(
     base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
@@ -696,6 +763,40 @@ std::string PublisherInfoDatabase::GetDiagnosticInfo(int extended_error,
   return db_.GetDiagnosticInfo(extended_error, statement);
 }
 
+bool PublisherInfoDatabase::ApplyTuning() {
+  if (tuning_.mmap_size > 0) {
+    const std::string query = base::StringPrintf(
+        "PRAGMA mmap_size=%" PRId64,
+        tuning_.mmap_size);
+
+    if (!db_.Execute(query.c_str())) {
+      return false;
+    }
+  }
+
+  if (tuning_.wal_mode) {
+    // journal_mode returns the resulting mode instead of failing, so check
+    // that WAL was actually picked up
+    sql::Statement statement(
+        db_.GetUniqueStatement("PRAGMA journal_mode=WAL"));
+    if (!statement.Step() ||
+        base::ToLowerASCII(statement.ColumnString(0)) != "wal") {
+      return false;
+    }
+
+    // Durable across application crashes, which is all WAL needs
+    if (!db_.Execute("PRAGMA synchronous=NORMAL")) {
+      return false;
+    }
+  }
+
+  if (read_only_ && !db_.Execute("PRAGMA query_only=ON")) {
+    return false;
+  }
+
+  return true;
+}
+
 sql::Database& PublisherInfoDatabase::GetDB() {
   return db_;
 }
@@ -959,6 +1060,27 @@ bool PublisherInfoDatabase::MigrateV14toV15() {
   return transaction.Commit();
 }
 
+bool PublisherInfoDatabase::MigrateV15toV16() {
+  sql::Transaction transaction(&GetDB());
+  if (!transaction.Begin()) {
+    return false;
+  }
+
+  if (!activity_info_->Migrate(&GetDB(), 16)) {
+    return false;
+  }
+
+  if (!contribution_info_->Migrate(&GetDB(), 16)) {
+    return false;
+  }
+
+  if (!publisher_info_->Migrate(&GetDB(), 16)) {
+    return false;
+  }
+
+  return transaction.Commit();
+}
+
 bool PublisherInfoDatabase::Migrate(int version) {
   switch (version) {
     case 1: {
@@ -1006,6 +1128,9 @@ bool PublisherInfoDatabase::Migrate(int version) {
     case 15: {
       return MigrateV14toV15();
     }
+    case 16: {
+      return MigrateV15toV16();
+    }
     default:
       NOTREACHED();
       return false;
@@ -1019,11 +1144,21 @@ sql::InitStatus PublisherInfoDatabase::EnsureCurrentVersion(
   const int current_version = GetCurrentVersion();
   const int start_version = old_version + 1;
 
-  int migrated_version = old_version;
+  // Each version is migrated in its own transaction together with its
+  // version bump, so an interrupted upgrade resumes from the last finished
+  // version and no single transaction spans the whole upgrade. A failed
+  // version is rolled back and fails Init(), so the database is never used
+  // with a partly migrated schema
   for (auto i = start_version; i <= current_version; i++) {
+    base::ElapsedTimer timer;
+    sql::Transaction transaction(&GetDB());
+    if (!transaction.Begin()) {
+      return sql::INIT_FAILURE;
+    }
+
     if (!Migrate(i)) {
       LOG(ERROR) << "DB: Error with MigrateV" << (i - 1) << "toV" << i;
-      break;
+      return sql::INIT_FAILURE;
     }
 
     if (i == 1) {
@@ -1032,11 +1167,15 @@ sql::InitStatus PublisherInfoDatabase::EnsureCurrentVersion(
       }
     }
 
-    migrated_version = i;
-  }
+    if (!GetMetaTable().SetVersionNumber(i) || !transaction.Commit()) {
+      LOG(ERROR) << "DB: Error committing MigrateV" << (i - 1) << "toV" << i;
+      return sql::INIT_FAILURE;
+    }
 
+    VLOG(1) << "DB: Migrated to version " << i << " of " << current_version
+        << " in " << timer.Elapsed().InMilliseconds() << "ms";
+  }
 
-  GetMetaTable().SetVersionNumber(migrated_version);
   return sql::INIT_OK;
 }
 
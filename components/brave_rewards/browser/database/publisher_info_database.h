@@ -37,6 +37,16 @@
 
 namespace brave_rewards {
 
+// Opt-in connection tuning. Zero values keep the sql::Database defaults.
+struct PublisherInfoDatabaseTuning {
+  bool wal_mode = false;
+  int page_size = 0;
+  // in pages
+  int cache_size = 0;
+  // in bytes
+  int64_t mmap_size = 0;
+};
+
 class PublisherInfoDatabase {
  public:
   PublisherInfoDatabase(
@@ -44,6 +54,19 @@ class PublisherInfoDatabase {
       const int testing_current_version = -1);
   ~PublisherInfoDatabase();
 
+  // Call before Init()
+  void set_tuning(const PublisherInfoDatabaseTuning& tuning) {
+    tuning_ = tuning;
+  }
+
+  // Call before Init(). A read-only connection never migrates the schema,
+  // so it must only be initialized after the writing connection has been.
+  // Only useful together with WAL mode, where readers don't wait on the
+  // writer.
+  void set_read_only(bool read_only) {
+    read_only_ = read_only;
+  }
+
   // Call before Init() to set the error callback to be used for the
   // underlying database connection.
   void set_error_callback(const sql::Database::ErrorCallback& error_callback) {
@@ -76,6 +99,14 @@ class PublisherInfoDatabase {
                        ledger::ActivityInfoFilterPtr filter,
                        ledger::PublisherInfoList* list);
 
+  bool GetActivityListPage(ledger::ActivityInfoFilterPtr filter,
+                           const uint32_t after_percent,
+                           const std::string& after_publisher_key,
+                           const int limit,
+                           ledger::PublisherInfoList* list);
+
+  int GetActivityListCount(ledger::ActivityInfoFilterPtr filter);
+
   bool GetExcludedList(ledger::PublisherInfoList* list);
 
   bool InsertOrUpdateMediaPublisherInfo(
@@ -166,6 +197,10 @@ class PublisherInfoDatabase {
   // unused space in the file. It can be VERY SLOW.
   void Vacuum();
 
+  // Cheap periodic upkeep meant for idle time: checkpoints the WAL file
+  // back into the database and lets SQLite refresh its planner statistics.
+  void RunMaintenance();
+
   std::string GetDiagnosticInfo(int extended_error, sql::Statement* statement);
 
   sql::Database& GetDB();
@@ -179,6 +214,8 @@ class PublisherInfoDatabase {
  private:
   bool IsInitialized();
 
+  bool ApplyTuning();
+
   void OnMemoryPressure(
     base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level);
 
@@ -216,6 +253,8 @@ class PublisherInfoDatabase {
 
   bool MigrateV14toV15();
 
+  bool MigrateV15toV16();
+
   bool Migrate(int version);
 
   sql::InitStatus EnsureCurrentVersion(const int table_version);
@@ -225,6 +264,8 @@ class PublisherInfoDatabase {
   const base::FilePath db_path_;
   bool initialized_;
   int testing_current_version_;
+  PublisherInfoDatabaseTuning tuning_;
+  bool read_only_;
 
   std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
   std::unique_ptr<DatabaseServerPublisherInfo> server_publisher_info_;
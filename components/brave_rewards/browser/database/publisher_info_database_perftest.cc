@@ -0,0 +1,466 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <inttypes.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/base_paths.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/path_service.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
+#include "base/timer/elapsed_timer.h"
+#include "bat/ledger/mojom_structs.h"
+#include "brave/components/brave_rewards/browser/database/database_util.h"
+#include "brave/components/brave_rewards/browser/database/publisher_info_database.h"
+#include "sql/database.h"
+#include "sql/statement.h"
+#include "sql/transaction.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_test.h"
+
+// npm run test -- brave_perftests --filter=PublisherInfoDatabase*PerfTest.*
+
+namespace brave_rewards {
+
+namespace {
+
+const size_t kRowCount = 100000;
+
+// Large profile, roughly a year of heavy use
+const int kServerPublisherCount = 200000;
+const int kPublisherCount = 20000;
+const int kActivityCount = 20000;
+const int kContributionCount = 5000;
+const int kPendingContributionCount = 2000;
+const int kPromotionCount = 200;
+const int kUnblindedTokenCount = 5000;
+const int kMonthCount = 12;
+
+// Rows added to every table of an old schema before migrating it
+const int kMigrationRowCount = 20000;
+const int kOldestMigrationVersion = 3;
+
+const int kReportYear = 2019;
+// 2019-01-01 00:00:00 UTC
+const int64_t kReportYearStart = 1546300800;
+const int64_t kSecondsPerMonth = 30 * 24 * 60 * 60;
+const uint64_t kFirstReconcileStamp = kReportYearStart;
+
+const int kQueryIterations = 20;
+
+// Runs |insert| once per row of a generated |seq(i)| table with |count| rows
+bool Populate(sql::Database* db, const std::string& insert, const int count) {
+  const std::string query = base::StringPrintf(
+      "WITH RECURSIVE seq(i) AS "
+      "(SELECT 0 UNION ALL SELECT i + 1 FROM seq WHERE i < %d) %s",
+      count - 1,
+      insert.c_str());
+  return db->Execute(query.c_str());
+}
+
+// Fills every table of an old schema version with |count| rows, deriving
+// the column values from the declared type only
+bool InflateTables(sql::Database* db, const int count) {
+  std::vector<std::string> tables;
+  sql::Statement table_statement(db->GetUniqueStatement(
+      "SELECT name FROM sqlite_master WHERE type = 'table' "
+      "AND name NOT IN ('meta', 'sqlite_sequence')"));
+  while (table_statement.Step()) {
+    tables.push_back(table_statement.ColumnString(0));
+  }
+
+  for (const auto& table : tables) {
+    std::string columns;
+    std::string values;
+    const std::string info_query = "PRAGMA table_info(" + table + ")";
+    sql::Statement info(db->GetUniqueStatement(info_query.c_str()));
+    while (info.Step()) {
+      const std::string type = base::ToUpperASCII(info.ColumnString(2));
+      const bool primary_key = info.ColumnInt(5) > 0;
+
+      std::string value = "'publisher' || i || '.com'";
+      if (type.find("TIMESTAMP") != std::string::npos) {
+        value = base::StringPrintf("%" PRId64 " + i * 60", kReportYearStart);
+      } else if (type.find("INT") != std::string::npos ||
+                 type.find("DOUBLE") != std::string::npos ||
+                 type.find("BOOL") != std::string::npos) {
+        value = primary_key ? "i" : "i % 3";
+      }
+
+      columns += (columns.empty() ? "" : ", ") + info.ColumnString(1);
+      values += (values.empty() ? "" : ", ") + value;
+    }
+
+    const std::string insert = base::StringPrintf(
+        "INSERT OR IGNORE INTO %s (%s) SELECT %s FROM seq",
+        table.c_str(),
+        columns.c_str(),
+        values.c_str());
+    if (!Populate(db, insert, count)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+class PublisherInfoDatabasePerfTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(db_.OpenInMemory());
+    ASSERT_TRUE(db_.Execute(
+        "CREATE TABLE server_publisher_info ("
+        "publisher_key LONGVARCHAR PRIMARY KEY NOT NULL UNIQUE,"
+        "status INTEGER DEFAULT 0 NOT NULL,"
+        "excluded INTEGER DEFAULT 0 NOT NULL,"
+        "address TEXT NOT NULL)"));
+
+    for (size_t i = 0; i < kRowCount; i++) {
+      keys_.push_back(base::StringPrintf("publisher%zu.com", i));
+    }
+  }
+
+  void Clear() {
+    ASSERT_TRUE(db_.Execute("DELETE FROM server_publisher_info"));
+  }
+
+  void Report(const std::string& trace, const base::TimeDelta& elapsed) {
+    perf_test::PrintResult(
+        "publisher_info_database_insert",
+        "",
+        trace,
+        kRowCount / elapsed.InSecondsF(),
+        "rows/s",
+        true);
+  }
+
+  sql::Database db_;
+  std::vector<std::string> keys_;
+};
+
+TEST_F(PublisherInfoDatabasePerfTest, InsertRowByRow) {
+  base::ElapsedTimer timer;
+
+  sql::Transaction transaction(&db_);
+  ASSERT_TRUE(transaction.Begin());
+  for (const auto& key : keys_) {
+    sql::Statement statement(db_.GetCachedStatement(SQL_FROM_HERE,
+        "INSERT OR REPLACE INTO server_publisher_info "
+        "(publisher_key, status, excluded, address) VALUES (?, ?, ?, ?)"));
+    statement.BindString(0, key);
+    statement.BindInt(1, 2);
+    statement.BindBool(2, false);
+    statement.BindString(3, key);
+    ASSERT_TRUE(statement.Run());
+  }
+  ASSERT_TRUE(transaction.Commit());
+
+  Report("row_by_row", timer.Elapsed());
+  Clear();
+}
+
+TEST_F(PublisherInfoDatabasePerfTest, BatchInsert) {
+  base::ElapsedTimer timer;
+
+  sql::Transaction transaction(&db_);
+  ASSERT_TRUE(transaction.Begin());
+  const bool success = BatchInsert(
+      &db_,
+      SQL_FROM_HERE,
+      "INSERT OR REPLACE INTO server_publisher_info "
+      "(publisher_key, status, excluded, address)",
+      4,
+      keys_.size(),
+      [&](sql::Statement* statement, size_t row, int index) {
+        statement->BindString(index, keys_[row]);
+        statement->BindInt(index + 1, 2);
+        statement->BindBool(index + 2, false);
+        statement->BindString(index + 3, keys_[row]);
+      });
+  ASSERT_TRUE(success);
+  ASSERT_TRUE(transaction.Commit());
+
+  Report("batch", timer.Elapsed());
+  Clear();
+}
+
+class PublisherInfoDatabaseProfilePerfTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+  }
+
+  std::unique_ptr<PublisherInfoDatabase> CreateDatabase(
+      const std::string& name) {
+    auto database = std::make_unique<PublisherInfoDatabase>(
+        temp_dir_.GetPath().AppendASCII(name));
+    if (!database->Init()) {
+      return nullptr;
+    }
+    return database;
+  }
+
+  ledger::ServerPublisherInfoList GetServerPublisherList() {
+    ledger::ServerPublisherInfoList list;
+    for (int i = 0; i < kServerPublisherCount; i++) {
+      auto info = ledger::ServerPublisherInfo::New();
+      info->publisher_key = base::StringPrintf("publisher%d.com", i);
+      info->status = static_cast<ledger::PublisherStatus>(i % 3);
+      info->address = info->publisher_key;
+      if (i % 100 == 0) {
+        info->banner = ledger::PublisherBanner::New();
+        info->banner->title = info->publisher_key;
+        info->banner->amounts = {1, 5, 10};
+      }
+      list.push_back(std::move(info));
+    }
+    return list;
+  }
+
+  // Everything but the server publisher list, which the tests time
+  void PopulateProfile(sql::Database* db) {
+    sql::Transaction transaction(db);
+    ASSERT_TRUE(transaction.Begin());
+
+    ASSERT_TRUE(Populate(db,
+        "INSERT INTO publisher_info "
+        "(publisher_id, excluded, name, favIcon, url, provider) "
+        "SELECT 'publisher' || i || '.com', i % 50 = 0, 'name', '', "
+        "'https://publisher' || i || '.com', '' FROM seq",
+        kPublisherCount));
+
+    ASSERT_TRUE(Populate(db, base::StringPrintf(
+        "INSERT INTO activity_info "
+        "(publisher_id, duration, visits, score, percent, weight, "
+        "reconcile_stamp) "
+        "SELECT 'publisher' || (i / %d) || '.com', i %% 300, 1 + i %% 20, "
+        "i %% 7, i %% 100, i %% 7, %" PRIu64 " + (i %% %d) * %" PRId64 " "
+        "FROM seq",
+        kMonthCount,
+        kFirstReconcileStamp,
+        kMonthCount,
+        kSecondsPerMonth), kActivityCount));
+
+    ASSERT_TRUE(Populate(db, base::StringPrintf(
+        "INSERT INTO contribution_info "
+        "(contribution_id, amount, type, step, retry_count, created_at) "
+        "SELECT 'contribution' || i, 1 + i %% 10, "
+        "CASE i %% 3 WHEN 0 THEN 2 WHEN 1 THEN 8 ELSE 16 END, -1, -1, "
+        "%" PRId64 " + i * %" PRId64 " FROM seq",
+        kReportYearStart,
+        kMonthCount * kSecondsPerMonth / kContributionCount),
+        kContributionCount));
+
+    ASSERT_TRUE(Populate(db, base::StringPrintf(
+        "INSERT INTO contribution_info_publishers "
+        "(contribution_id, publisher_key, total_amount, contributed_amount) "
+        "SELECT 'contribution' || (i / 3), "
+        "'publisher' || (i %% %d) || '.com', 1, 1 FROM seq",
+        kPublisherCount), kContributionCount * 3));
+
+    ASSERT_TRUE(Populate(db, base::StringPrintf(
+        "INSERT INTO pending_contribution "
+        "(publisher_id, amount, added_date, viewing_id, type) "
+        "SELECT 'publisher' || (i %% %d) || '.com', 1 + i %% 10, "
+        "%" PRId64 " + i, '', 8 FROM seq",
+        kPublisherCount,
+        kReportYearStart), kPendingContributionCount));
+
+    ASSERT_TRUE(Populate(db, base::StringPrintf(
+        "INSERT INTO promotion "
+        "(promotion_id, version, type, public_keys, suggestions, "
+        "approximate_value, status, expires_at, created_at, claimed_at) "
+        "SELECT 'promotion' || i, 5, i %% 2, '[]', 30, 30, 4, "
+        "%" PRId64 ", %" PRId64 ", %" PRId64 " + i * %" PRId64 " FROM seq",
+        kReportYearStart + kMonthCount * kSecondsPerMonth,
+        kReportYearStart,
+        kReportYearStart,
+        kMonthCount * kSecondsPerMonth / kPromotionCount),
+        kPromotionCount));
+
+    ASSERT_TRUE(Populate(db, base::StringPrintf(
+        "INSERT INTO unblinded_tokens "
+        "(token_value, public_key, value, promotion_id) "
+        "SELECT 'token' || i, 'key', 0.25, 'promotion' || (i %% %d) "
+        "FROM seq",
+        kPromotionCount), kUnblindedTokenCount));
+
+    ASSERT_TRUE(transaction.Commit());
+  }
+
+  void Report(
+      const std::string& measurement,
+      const std::string& trace,
+      const base::TimeDelta& elapsed) {
+    perf_test::PrintResult(
+        measurement,
+        "",
+        trace,
+        elapsed.InMillisecondsF(),
+        "ms",
+        true);
+  }
+
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(PublisherInfoDatabaseProfilePerfTest, Migration) {
+  base::FilePath data_path;
+  ASSERT_TRUE(base::PathService::Get(base::DIR_SOURCE_ROOT, &data_path));
+  data_path = data_path.AppendASCII("brave").AppendASCII("test")
+      .AppendASCII("data").AppendASCII("rewards-data")
+      .AppendASCII("migration");
+
+  const int current_version =
+      PublisherInfoDatabase(temp_dir_.GetPath().AppendASCII("current"))
+          .GetCurrentVersion();
+
+  for (int version = kOldestMigrationVersion;
+       version < current_version;
+       version++) {
+    const std::string file_name =
+        base::StringPrintf("publisher_info_db_v%d", version);
+    const base::FilePath db_file = temp_dir_.GetPath().AppendASCII(file_name);
+    ASSERT_TRUE(base::CopyFile(data_path.AppendASCII(file_name), db_file));
+
+    {
+      sql::Database db;
+      ASSERT_TRUE(db.Open(db_file));
+      sql::Transaction transaction(&db);
+      ASSERT_TRUE(transaction.Begin());
+      ASSERT_TRUE(InflateTables(&db, kMigrationRowCount));
+      ASSERT_TRUE(transaction.Commit());
+    }
+
+    base::ElapsedTimer timer;
+    PublisherInfoDatabase database(db_file);
+    ASSERT_TRUE(database.Init());
+    Report(
+        "publisher_info_database_migration",
+        base::StringPrintf("v%d", version),
+        timer.Elapsed());
+  }
+}
+
+TEST_F(PublisherInfoDatabaseProfilePerfTest,
+       ClearAndInsertServerPublisherList) {
+  auto database = CreateDatabase("profile");
+  ASSERT_TRUE(database);
+
+  // The first insert writes into an empty table, the second one has to
+  // clear the previous list first
+  base::ElapsedTimer first_timer;
+  ASSERT_TRUE(
+      database->ClearAndInsertServerPublisherList(GetServerPublisherList()));
+  Report(
+      "publisher_info_database_server_publisher_list",
+      "insert",
+      first_timer.Elapsed());
+
+  base::ElapsedTimer second_timer;
+  ASSERT_TRUE(
+      database->ClearAndInsertServerPublisherList(GetServerPublisherList()));
+  Report(
+      "publisher_info_database_server_publisher_list",
+      "clear_and_insert",
+      second_timer.Elapsed());
+}
+
+TEST_F(PublisherInfoDatabaseProfilePerfTest, ActivityList) {
+  auto database = CreateDatabase("profile");
+  ASSERT_TRUE(database);
+  ASSERT_TRUE(
+      database->ClearAndInsertServerPublisherList(GetServerPublisherList()));
+  PopulateProfile(&database->GetDB());
+
+  size_t count = 0;
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kQueryIterations; i++) {
+    // Same filter as the auto-contribute list in the rewards panel
+    auto filter = ledger::ActivityInfoFilter::New();
+    filter->min_duration = 8;
+    auto pair = ledger::ActivityInfoFilterOrderPair::New("ai.percent", false);
+    filter->order_by.push_back(std::move(pair));
+    filter->reconcile_stamp =
+        kFirstReconcileStamp + (i % kMonthCount) * kSecondsPerMonth;
+    filter->excluded = ledger::ExcludeFilter::FILTER_ALL_EXCEPT_EXCLUDED;
+    filter->percent = 1;
+    filter->non_verified = false;
+    filter->min_visits = 1;
+
+    ledger::PublisherInfoList list;
+    ASSERT_TRUE(database->GetActivityList(0, 0, std::move(filter), &list));
+    count += list.size();
+  }
+  EXPECT_GT(count, 0u);
+
+  Report(
+      "publisher_info_database_activity_list",
+      "auto_contribute",
+      timer.Elapsed() / kQueryIterations);
+}
+
+TEST_F(PublisherInfoDatabaseProfilePerfTest, BalanceReport) {
+  auto database = CreateDatabase("profile");
+  ASSERT_TRUE(database);
+  ASSERT_TRUE(
+      database->ClearAndInsertServerPublisherList(GetServerPublisherList()));
+  PopulateProfile(&database->GetDB());
+
+  // The monthly statement reads transactions, contributions and tips
+  base::ElapsedTimer timer;
+  for (int month = 1; month <= kMonthCount; month++) {
+    const auto activity_month = static_cast<ledger::ActivityMonth>(month);
+
+    ledger::TransactionReportInfoList transactions;
+    database->GetTransactionReport(&transactions, activity_month, kReportYear);
+
+    ledger::ContributionReportInfoList contributions;
+    database->GetContributionReport(
+        &contributions,
+        activity_month,
+        kReportYear);
+
+    ledger::PublisherInfoList tips;
+    database->GetOneTimeTips(&tips, activity_month, kReportYear);
+
+    EXPECT_FALSE(contributions.empty());
+  }
+
+  Report(
+      "publisher_info_database_balance_report",
+      "month",
+      timer.Elapsed() / kMonthCount);
+
+  base::ElapsedTimer pending_timer;
+  ledger::PendingContributionInfoList pending;
+  database->GetPendingContributions(&pending);
+  database->GetReservedAmount();
+  EXPECT_EQ(static_cast<int>(pending.size()), kPendingContributionCount);
+  Report(
+      "publisher_info_database_pending_contributions",
+      "list",
+      pending_timer.Elapsed());
+
+  base::ElapsedTimer tokens_timer;
+  const auto tokens = database->GetAllUnblindedTokens();
+  EXPECT_EQ(static_cast<int>(tokens.size()), kUnblindedTokenCount);
+  Report(
+      "publisher_info_database_unblinded_tokens",
+      "list",
+      tokens_timer.Elapsed());
+}
+
+}  // namespace brave_rewards
@@ -0,0 +1,210 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/strings/string_util.h"
+#include "bat/ledger/mojom_structs.h"
+#include "brave/components/brave_rewards/browser/database/database_activity_info.h"
+#include "brave/components/brave_rewards/browser/database/database_contribution_info.h"
+#include "brave/components/brave_rewards/browser/database/database_pending_contribution.h"
+#include "brave/components/brave_rewards/browser/database/database_publisher_info.h"
+#include "brave/components/brave_rewards/browser/database/database_recurring_tip.h"
+#include "brave/components/brave_rewards/browser/database/publisher_info_database.h"
+#include "sql/database.h"
+#include "sql/statement.h"
+#include "sql/transaction.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=PublisherInfoDatabaseQueryPlanTest.*
+
+namespace brave_rewards {
+
+namespace {
+
+// Number of publishers in the synthetic profile, large enough that the query
+// planner prefers an index whenever a usable one exists
+const int kPublisherCount = 100000;
+
+}  // namespace
+
+class PublisherInfoDatabaseQueryPlanTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    publisher_info_database_ = std::make_unique<PublisherInfoDatabase>(
+        temp_dir_.GetPath().AppendASCII("PublisherInfoDatabaseTest.db"));
+    ASSERT_TRUE(publisher_info_database_->Init());
+    PopulateDatabase();
+  }
+
+  sql::Database& GetDB() {
+    return publisher_info_database_->GetDB();
+  }
+
+  void Populate(const std::string& insert, const int count) {
+    const std::string query =
+        "WITH RECURSIVE seq(i) AS "
+        "(SELECT 0 UNION ALL SELECT i + 1 FROM seq WHERE i < " +
+        std::to_string(count - 1) + ") " + insert;
+    ASSERT_TRUE(GetDB().Execute(query.c_str()));
+  }
+
+  void PopulateDatabase() {
+    sql::Transaction transaction(&GetDB());
+    ASSERT_TRUE(transaction.Begin());
+
+    Populate(
+        "INSERT INTO publisher_info "
+        "(publisher_id, excluded, name, favIcon, url, provider) "
+        "SELECT 'publisher' || i || '.com', i % 50 = 0, 'name', '', 'url', '' "
+        "FROM seq",
+        kPublisherCount);
+
+    Populate(
+        "INSERT INTO server_publisher_info "
+        "(publisher_key, status, excluded, address) "
+        "SELECT 'publisher' || i || '.com', i % 3, 0, '' FROM seq",
+        kPublisherCount);
+
+    Populate(
+        "INSERT INTO activity_info "
+        "(publisher_id, duration, visits, score, percent, weight, "
+        "reconcile_stamp) "
+        "SELECT 'publisher' || i || '.com', i % 100, i % 10, 1, 1, 1, "
+        "1000 + i % 12 FROM seq",
+        kPublisherCount / 5);
+
+    Populate(
+        "INSERT INTO contribution_info "
+        "(contribution_id, amount, type, step, retry_count, created_at) "
+        "SELECT 'contribution' || i, 1, 2 + i % 3, -1, -1, "
+        "1500000000 + i * 3600 FROM seq",
+        kPublisherCount / 20);
+
+    Populate(
+        "INSERT INTO contribution_info_publishers "
+        "(contribution_id, publisher_key, total_amount, contributed_amount) "
+        "SELECT 'contribution' || i, 'publisher' || i || '.com', 1, 1 "
+        "FROM seq",
+        kPublisherCount / 20);
+
+    Populate(
+        "INSERT INTO pending_contribution "
+        "(publisher_id, amount, added_date, viewing_id, type) "
+        "SELECT 'publisher' || i || '.com', 1, 1, '', 1 FROM seq",
+        kPublisherCount / 200);
+
+    Populate(
+        "INSERT INTO recurring_donation (publisher_id, amount, added_date) "
+        "SELECT 'publisher' || i || '.com', 1, 1 FROM seq",
+        kPublisherCount / 1000);
+
+    ASSERT_TRUE(transaction.Commit());
+  }
+
+  // Returns the plan details of |query| that read a whole table. |allowed| is
+  // the alias of the table the query is expected to walk, e.g. when every row
+  // of it is returned anyway
+  std::vector<std::string> GetTableScans(
+      const std::string& query,
+      const std::string& allowed) {
+    const std::string plan_query = "EXPLAIN QUERY PLAN " + query;
+    sql::Statement statement(GetDB().GetUniqueStatement(plan_query.c_str()));
+    EXPECT_TRUE(statement.is_valid());
+
+    std::vector<std::string> scans;
+    while (statement.Step()) {
+      // Older SQLite reports "SCAN TABLE x AS y", newer "SCAN y"
+      const std::string detail = statement.ColumnString(3);
+      if (!base::StartsWith(detail, "SCAN ", base::CompareCase::SENSITIVE)) {
+        continue;
+      }
+
+      if (!allowed.empty() &&
+          (detail == "SCAN " + allowed ||
+           base::EndsWith(detail, " AS " + allowed,
+                          base::CompareCase::SENSITIVE))) {
+        continue;
+      }
+
+      scans.push_back(detail);
+    }
+
+    return scans;
+  }
+
+  base::ScopedTempDir temp_dir_;
+  std::unique_ptr<PublisherInfoDatabase> publisher_info_database_;
+};
+
+TEST_F(PublisherInfoDatabaseQueryPlanTest, ActivityInfoList) {
+  // Same filter as the auto-contribute list in the rewards panel
+  auto filter = ledger::ActivityInfoFilter::New();
+  filter->min_duration = 8;
+  auto pair = ledger::ActivityInfoFilterOrderPair::New("ai.percent", false);
+  filter->order_by.push_back(std::move(pair));
+  filter->reconcile_stamp = 1005;
+  filter->excluded = ledger::ExcludeFilter::FILTER_ALL_EXCEPT_EXCLUDED;
+  filter->percent = 1;
+  filter->non_verified = false;
+  filter->min_visits = 1;
+
+  const std::string query =
+      DatabaseActivityInfo::GetRecordsListQuery(0, 0, std::move(filter));
+  EXPECT_TRUE(GetTableScans(query, "").empty()) << query;
+}
+
+TEST_F(PublisherInfoDatabaseQueryPlanTest, ActivityInfoPage) {
+  auto filter = ledger::ActivityInfoFilter::New();
+  filter->min_duration = 8;
+  filter->reconcile_stamp = 1005;
+  filter->excluded = ledger::ExcludeFilter::FILTER_ALL_EXCEPT_EXCLUDED;
+  filter->percent = 1;
+  filter->non_verified = false;
+  filter->min_visits = 1;
+
+  const std::string query =
+      DatabaseActivityInfo::GetRecordsPageQuery(std::move(filter), true, 50);
+  EXPECT_TRUE(GetTableScans(query, "").empty()) << query;
+}
+
+TEST_F(PublisherInfoDatabaseQueryPlanTest, PendingContributions) {
+  const std::string query = DatabasePendingContribution::GetAllRecordsQuery();
+  EXPECT_TRUE(GetTableScans(query, "pc").empty()) << query;
+}
+
+TEST_F(PublisherInfoDatabaseQueryPlanTest, RecurringTips) {
+  const std::string query = DatabaseRecurringTip::GetAllRecordsQuery();
+  EXPECT_TRUE(GetTableScans(query, "rd").empty()) << query;
+}
+
+TEST_F(PublisherInfoDatabaseQueryPlanTest, OneTimeTips) {
+  const std::string query = DatabaseContributionInfo::GetOneTimeTipsQuery();
+  EXPECT_TRUE(GetTableScans(query, "").empty()) << query;
+}
+
+TEST_F(PublisherInfoDatabaseQueryPlanTest, ContributionReport) {
+  const std::string query =
+      DatabaseContributionInfo::GetContributionReportQuery();
+  EXPECT_TRUE(GetTableScans(query, "").empty()) << query;
+}
+
+TEST_F(PublisherInfoDatabaseQueryPlanTest, PanelPublisherInfo) {
+  const std::string query = DatabasePublisherInfo::GetPanelRecordQuery();
+  EXPECT_TRUE(GetTableScans(query, "").empty()) << query;
+}
+
+TEST_F(PublisherInfoDatabaseQueryPlanTest, ExcludedList) {
+  const std::string query = DatabasePublisherInfo::GetExcludedListQuery();
+  EXPECT_TRUE(GetTableScans(query, "").empty()) << query;
+}
+
+}  // namespace brave_rewards
@@ -7,6 +7,7 @@
 #include <streambuf>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "brave/components/brave_rewards/browser/database/publisher_info_database.h"
 
@@ -22,6 +23,7 @@
 #include "bat/ledger/global_constants.h"
 #include "sql/database.h"
 #include "sql/statement.h"
+#include "sql/test/scoped_error_expecter.h"
 #include "third_party/sqlite/sqlite3.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -961,6 +963,80 @@ TEST_F(PublisherInfoDatabaseTest, GetActivityList) {
 }
 
 
+TEST_F(PublisherInfoDatabaseTest, GetActivityListPage) {
+  base::ScopedTempDir temp_dir;
+  base::FilePath db_file;
+  CreateTempDatabase(&temp_dir, &db_file);
+
+  const std::vector<std::pair<std::string, uint32_t>> publishers = {
+    {"publisher_1", 10},
+    {"publisher_2", 40},
+    {"publisher_3", 10},
+    {"publisher_4", 25},
+    {"publisher_5", 10},
+    {"publisher_6", 5},
+    {"publisher_7", 0}
+  };
+
+  for (const auto& publisher : publishers) {
+    auto info = ledger::PublisherInfo::New();
+    info->id = publisher.first;
+    info->name = publisher.first;
+    info->url = "https://" + publisher.first + ".com";
+    info->excluded = ledger::PublisherExclude::DEFAULT;
+    info->duration = 10;
+    info->visits = 1;
+    info->percent = publisher.second;
+    info->reconcile_stamp = 1;
+    EXPECT_TRUE(
+        publisher_info_database_->InsertOrUpdateActivityInfo(info->Clone()));
+  }
+
+  auto filter = ledger::ActivityInfoFilter::New();
+  filter->reconcile_stamp = 1;
+  filter->percent = 1;
+  filter->excluded = ledger::ExcludeFilter::FILTER_ALL_EXCEPT_EXCLUDED;
+
+  EXPECT_EQ(publisher_info_database_->GetActivityListCount(filter->Clone()),
+      6);
+
+  // Read the list three records at a time, every page continues after the
+  // last record of the previous one
+  std::vector<std::string> ids;
+  uint32_t after_percent = 0;
+  std::string after_publisher_key;
+  for (int page = 0; page < 3; page++) {
+    ledger::PublisherInfoList list;
+    EXPECT_TRUE(publisher_info_database_->GetActivityListPage(
+        filter->Clone(),
+        after_percent,
+        after_publisher_key,
+        3,
+        &list));
+
+    for (const auto& info : list) {
+      ids.push_back(info->id);
+    }
+
+    if (list.empty()) {
+      break;
+    }
+
+    after_percent = list.back()->percent;
+    after_publisher_key = list.back()->id;
+  }
+
+  const std::vector<std::string> expected_ids = {
+    "publisher_2",
+    "publisher_4",
+    "publisher_1",
+    "publisher_3",
+    "publisher_5",
+    "publisher_6"
+  };
+  EXPECT_EQ(ids, expected_ids);
+}
+
 TEST_F(PublisherInfoDatabaseTest, Migrationv3tov4) {
   base::ScopedTempDir temp_dir;
   base::FilePath db_file;
@@ -1122,6 +1198,35 @@ TEST_F(PublisherInfoDatabaseTest, Migrationv6tov7) {
   EXPECT_EQ(schema, GetSchemaString(7));
 }
 
+TEST_F(PublisherInfoDatabaseTest, FailedMigrationFailsInit) {
+  base::ScopedTempDir temp_dir;
+  base::FilePath db_file;
+  CreateMigrationDatabase(&temp_dir, &db_file, 6, 8);
+
+  // Migrating to version 8 renames this table
+  {
+    sql::Database db;
+    ASSERT_TRUE(db.Open(db_file));
+    ASSERT_TRUE(db.Execute("DROP TABLE contribution_info"));
+  }
+
+  {
+    sql::test::ScopedErrorExpecter expecter;
+    expecter.ExpectError(SQLITE_ERROR);
+    EXPECT_FALSE(publisher_info_database_->Init());
+    EXPECT_TRUE(expecter.SawExpectedErrors());
+  }
+  publisher_info_database_.reset();
+
+  // Version 7 was committed before version 8 failed
+  sql::Database db;
+  ASSERT_TRUE(db.Open(db_file));
+  sql::Statement statement(db.GetUniqueStatement(
+      "SELECT value FROM meta WHERE key = 'version'"));
+  ASSERT_TRUE(statement.Step());
+  EXPECT_EQ(statement.ColumnInt(0), 7);
+}
+
 TEST_F(PublisherInfoDatabaseTest, Migrationv7tov8) {
   base::ScopedTempDir temp_dir;
   base::FilePath db_file;
@@ -1368,6 +1473,18 @@ TEST_F(PublisherInfoDatabaseTest, Migrationv14tov15) {
   EXPECT_EQ(schema, GetSchemaString(15));
 }
 
+TEST_F(PublisherInfoDatabaseTest, Migrationv15tov16) {
+  base::ScopedTempDir temp_dir;
+  base::FilePath db_file;
+  CreateMigrationDatabase(&temp_dir, &db_file, 15, 16);
+  EXPECT_TRUE(publisher_info_database_->Init());
+
+  ASSERT_EQ(publisher_info_database_->GetTableVersionNumber(), 16);
+
+  const std::string schema = publisher_info_database_->GetSchema();
+  EXPECT_EQ(schema, GetSchemaString(16));
+}
+
 TEST_F(PublisherInfoDatabaseTest, DeleteActivityInfo) {
   base::ScopedTempDir temp_dir;
   base::FilePath db_file;
@@ -1564,6 +1681,128 @@ TEST_F(PublisherInfoDatabaseTest, RemoveAllPendingContributions) {
   EXPECT_EQ(CountTableRows("pending_contribution"), 0);
 }
 
+TEST_F(PublisherInfoDatabaseTest, ClearAndInsertServerPublisherListBatched) {
+  base::ScopedTempDir temp_dir;
+  base::FilePath db_file;
+  CreateTempDatabase(&temp_dir, &db_file);
+
+  // Spans several full batches plus a partial trailing one
+  const int count = 1000;
+  ledger::ServerPublisherInfoList list;
+  for (int i = 0; i < count; i++) {
+    auto info = ledger::ServerPublisherInfo::New();
+    info->publisher_key = base::StringPrintf("key%d.com", i);
+    info->status = ledger::PublisherStatus::VERIFIED;
+    info->excluded = i % 2 == 0;
+    info->address = base::StringPrintf("address%d", i);
+    list.push_back(std::move(info));
+  }
+
+  EXPECT_TRUE(
+      publisher_info_database_->ClearAndInsertServerPublisherList(list));
+  EXPECT_EQ(CountTableRows("server_publisher_info"), count);
+
+  auto info = publisher_info_database_->GetServerPublisherInfo("key999.com");
+  ASSERT_TRUE(info);
+  EXPECT_EQ(info->status, ledger::PublisherStatus::VERIFIED);
+  EXPECT_FALSE(info->excluded);
+  EXPECT_EQ(info->address, "address999");
+
+  // Inserting again replaces the list instead of appending to it
+  EXPECT_TRUE(
+      publisher_info_database_->ClearAndInsertServerPublisherList(list));
+  EXPECT_EQ(CountTableRows("server_publisher_info"), count);
+}
+
+TEST_F(PublisherInfoDatabaseTest, TuningWithReadOnlyConnection) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  const base::FilePath db_file =
+      temp_dir.GetPath().AppendASCII("PublisherInfoDatabaseTest.db");
+
+  PublisherInfoDatabaseTuning tuning;
+  tuning.wal_mode = true;
+  tuning.page_size = 4096;
+  tuning.cache_size = 500;
+  tuning.mmap_size = 1024 * 1024;
+
+  publisher_info_database_ = std::make_unique<PublisherInfoDatabase>(db_file);
+  publisher_info_database_->set_tuning(tuning);
+  ASSERT_TRUE(publisher_info_database_->Init());
+
+  sql::Statement journal_mode(
+      GetDB().GetUniqueStatement("PRAGMA journal_mode"));
+  ASSERT_TRUE(journal_mode.Step());
+  EXPECT_EQ(journal_mode.ColumnString(0), "wal");
+
+  auto info = ledger::PublisherInfo::New();
+  info->id = "brave.com";
+  info->url = "https://brave.com";
+  EXPECT_TRUE(
+      publisher_info_database_->InsertOrUpdatePublisherInfo(info->Clone()));
+
+  PublisherInfoDatabase reader(db_file);
+  reader.set_tuning(tuning);
+  reader.set_read_only(true);
+  ASSERT_TRUE(reader.Init());
+
+  auto result = reader.GetPublisherInfo("brave.com");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->url, "https://brave.com");
+
+  // Writes have to go through the main connection
+  {
+    sql::test::ScopedErrorExpecter expecter;
+    expecter.ExpectError(SQLITE_READONLY);
+    EXPECT_FALSE(reader.GetDB().Execute("DELETE FROM publisher_info"));
+    EXPECT_TRUE(expecter.SawExpectedErrors());
+  }
+  EXPECT_EQ(CountTableRows("publisher_info"), 1);
+
+  publisher_info_database_->RunMaintenance();
+  EXPECT_EQ(CountTableRows("publisher_info"), 1);
+}
+
+// The reader is only stale by writes which have not run yet, it does not keep
+// a snapshot of the database between reads
+TEST_F(PublisherInfoDatabaseTest, ReadOnlyConnectionSeesCommittedWrites) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  const base::FilePath db_file =
+      temp_dir.GetPath().AppendASCII("PublisherInfoDatabaseTest.db");
+
+  PublisherInfoDatabaseTuning tuning;
+  tuning.wal_mode = true;
+
+  publisher_info_database_ = std::make_unique<PublisherInfoDatabase>(db_file);
+  publisher_info_database_->set_tuning(tuning);
+  ASSERT_TRUE(publisher_info_database_->Init());
+
+  PublisherInfoDatabase reader(db_file);
+  reader.set_tuning(tuning);
+  reader.set_read_only(true);
+  ASSERT_TRUE(reader.Init());
+  EXPECT_FALSE(reader.GetPublisherInfo("brave.com"));
+
+  auto info = ledger::PublisherInfo::New();
+  info->id = "brave.com";
+  info->url = "https://brave.com";
+  EXPECT_TRUE(
+      publisher_info_database_->InsertOrUpdatePublisherInfo(info->Clone()));
+
+  auto result = reader.GetPublisherInfo("brave.com");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->url, "https://brave.com");
+
+  info->url = "https://brave.com/updated";
+  EXPECT_TRUE(
+      publisher_info_database_->InsertOrUpdatePublisherInfo(info->Clone()));
+
+  result = reader.GetPublisherInfo("brave.com");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->url, "https://brave.com/updated");
+}
+
 TEST_F(PublisherInfoDatabaseTest,
     ContributionQueueKeyOk) {
   base::ScopedTempDir temp_dir;
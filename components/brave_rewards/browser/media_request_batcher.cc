@@ -0,0 +1,91 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/media_request_batcher.h"
+
+#include <utility>
+
+namespace brave_rewards {
+
+namespace {
+
+constexpr base::TimeDelta kMediaRequestsFlushDelay =
+    base::TimeDelta::FromSeconds(10);
+const size_t kMaxPendingMediaRequestsPerTab = 50;
+
+}  // namespace
+
+MediaRequestBatcher::MediaRequestBatcher(FlushCallback callback)
+    : callback_(std::move(callback)) {
+}
+
+MediaRequestBatcher::~MediaRequestBatcher() = default;
+
+void MediaRequestBatcher::Add(
+    SessionID tab_id,
+    ledger::MediaRequestPtr request) {
+  auto& requests = pending_requests_[tab_id.id()];
+
+  for (const auto& pending : requests) {
+    if (pending->type == request->type &&
+        pending->url == request->url &&
+        pending->post_data == request->post_data) {
+      return;
+    }
+  }
+
+  requests.push_back(std::move(request));
+  if (requests.size() >= kMaxPendingMediaRequestsPerTab) {
+    Flush(tab_id);
+    return;
+  }
+
+  if (!timer_.IsRunning()) {
+    timer_.Start(
+        FROM_HERE,
+        kMediaRequestsFlushDelay,
+        this,
+        &MediaRequestBatcher::FlushAll);
+  }
+}
+
+void MediaRequestBatcher::Flush(SessionID tab_id) {
+  auto it = pending_requests_.find(tab_id.id());
+  if (it == pending_requests_.end()) {
+    return;
+  }
+
+  ledger::MediaRequestList requests = std::move(it->second);
+  pending_requests_.erase(it);
+
+  if (pending_requests_.empty()) {
+    timer_.Stop();
+  }
+
+  if (requests.empty()) {
+    return;
+  }
+
+  callback_.Run(std::move(requests));
+}
+
+void MediaRequestBatcher::FlushAll() {
+  ledger::MediaRequestList requests;
+  for (auto& tab : pending_requests_) {
+    for (auto& request : tab.second) {
+      requests.push_back(std::move(request));
+    }
+  }
+  pending_requests_.clear();
+  timer_.Stop();
+
+  if (requests.empty()) {
+    return;
+  }
+
+  callback_.Run(std::move(requests));
+}
+
+}  // namespace brave_rewards
@@ -0,0 +1,50 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_MEDIA_REQUEST_BATCHER_H_
+#define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_MEDIA_REQUEST_BATCHER_H_
+
+#include <map>
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "base/timer/timer.h"
+#include "bat/ledger/mojom_structs.h"
+#include "components/sessions/core/session_id.h"
+
+namespace brave_rewards {
+
+// Queues media pings per tab so they reach the ledger in batches instead of
+// one at a time. Requests of a tab are handed over in the order they were
+// added, exact duplicates are dropped as players resend identical heartbeats.
+// A batch is handed over when a tab is flushed or has queued 50 requests, and
+// every tab is flushed 10 seconds after the first pending request was added.
+class MediaRequestBatcher {
+ public:
+  using FlushCallback =
+      base::RepeatingCallback<void(ledger::MediaRequestList requests)>;
+
+  explicit MediaRequestBatcher(FlushCallback callback);
+  ~MediaRequestBatcher();
+
+  void Add(SessionID tab_id, ledger::MediaRequestPtr request);
+
+  // Hands over the requests of |tab_id|, which have to reach the ledger
+  // before the tab navigates, is hidden or is closed
+  void Flush(SessionID tab_id);
+
+  void FlushAll();
+
+ private:
+  FlushCallback callback_;
+  std::map<SessionID::id_type, ledger::MediaRequestList> pending_requests_;
+  base::OneShotTimer timer_;
+
+  DISALLOW_COPY_AND_ASSIGN(MediaRequestBatcher);
+};
+
+}  // namespace brave_rewards
+
+#endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_MEDIA_REQUEST_BATCHER_H_
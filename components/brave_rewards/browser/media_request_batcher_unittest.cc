@@ -0,0 +1,140 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/test/task_environment.h"
+#include "brave/components/brave_rewards/browser/media_request_batcher.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=MediaRequestBatcherTest.*
+
+namespace brave_rewards {
+
+using Batch = std::vector<std::string>;
+
+class MediaRequestBatcherTest : public testing::Test {
+ public:
+  MediaRequestBatcherTest()
+      : batcher_(base::BindRepeating(&MediaRequestBatcherTest::OnFlush,
+                                     base::Unretained(this))) {
+  }
+
+ protected:
+  void Add(const int tab_id, const std::string& url) {
+    auto request = ledger::MediaRequest::New();
+    request->type = ledger::MediaRequestType::XHR_LOAD;
+    request->url = url;
+    batcher_.Add(GetTabId(tab_id), std::move(request));
+  }
+
+  SessionID GetTabId(const int tab_id) {
+    return SessionID::FromSerializedValue(tab_id);
+  }
+
+  void OnFlush(ledger::MediaRequestList requests) {
+    Batch batch;
+    for (const auto& request : requests) {
+      batch.push_back(request->url);
+    }
+    batches_.push_back(batch);
+  }
+
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  MediaRequestBatcher batcher_;
+  std::vector<Batch> batches_;
+};
+
+// Flushed by the rewards service when a tab navigates, is hidden or is closed
+TEST_F(MediaRequestBatcherTest, FlushesOnlyThatTabInOrder) {
+  Add(1, "https://youtube.com/a");
+  Add(2, "https://twitch.tv/a");
+  Add(1, "https://youtube.com/b");
+
+  batcher_.Flush(GetTabId(1));
+
+  ASSERT_EQ(batches_.size(), 1u);
+  EXPECT_EQ(batches_[0],
+      Batch({"https://youtube.com/a", "https://youtube.com/b"}));
+
+  batcher_.FlushAll();
+
+  ASSERT_EQ(batches_.size(), 2u);
+  EXPECT_EQ(batches_[1], Batch({"https://twitch.tv/a"}));
+}
+
+TEST_F(MediaRequestBatcherTest, FlushesAllTabsAfterDelay) {
+  Add(1, "https://youtube.com/a");
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(9));
+  Add(2, "https://twitch.tv/a");
+  Add(1, "https://youtube.com/b");
+  EXPECT_TRUE(batches_.empty());
+
+  // The delay starts with the first pending request
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(1));
+
+  ASSERT_EQ(batches_.size(), 1u);
+  EXPECT_EQ(batches_[0], Batch({
+      "https://youtube.com/a",
+      "https://youtube.com/b",
+      "https://twitch.tv/a"}));
+
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(10));
+  EXPECT_EQ(batches_.size(), 1u);
+}
+
+TEST_F(MediaRequestBatcherTest, FlushingLastTabRestartsDelay) {
+  Add(1, "https://youtube.com/a");
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(5));
+  batcher_.Flush(GetTabId(1));
+  ASSERT_EQ(batches_.size(), 1u);
+
+  Add(1, "https://youtube.com/b");
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(5));
+  EXPECT_EQ(batches_.size(), 1u);
+
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(5));
+  ASSERT_EQ(batches_.size(), 2u);
+  EXPECT_EQ(batches_[1], Batch({"https://youtube.com/b"}));
+}
+
+TEST_F(MediaRequestBatcherTest, FlushesTabWhenFull) {
+  for (int i = 0; i < 49; i++) {
+    Add(1, "https://youtube.com/" + base::NumberToString(i));
+  }
+  EXPECT_TRUE(batches_.empty());
+
+  Add(1, "https://youtube.com/49");
+
+  ASSERT_EQ(batches_.size(), 1u);
+  EXPECT_EQ(batches_[0].size(), 50u);
+  EXPECT_EQ(batches_[0].front(), "https://youtube.com/0");
+  EXPECT_EQ(batches_[0].back(), "https://youtube.com/49");
+}
+
+TEST_F(MediaRequestBatcherTest, DropsDuplicateRequests) {
+  Add(1, "https://youtube.com/a");
+  Add(1, "https://youtube.com/a");
+  Add(2, "https://youtube.com/a");
+
+  batcher_.FlushAll();
+
+  ASSERT_EQ(batches_.size(), 1u);
+  EXPECT_EQ(batches_[0],
+      Batch({"https://youtube.com/a", "https://youtube.com/a"}));
+}
+
+TEST_F(MediaRequestBatcherTest, DoesNotFlushWithoutRequests) {
+  batcher_.Flush(GetTabId(1));
+  batcher_.FlushAll();
+
+  EXPECT_TRUE(batches_.empty());
+}
+
+}  // namespace brave_rewards
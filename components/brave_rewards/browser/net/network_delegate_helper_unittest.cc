@@ -0,0 +1,60 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/net/network_delegate_helper.h"
+
+#include <memory>
+#include <string>
+
+#include "brave/browser/net/url_context.h"
+#include "content/public/test/browser_task_environment.h"
+#include "net/base/net_errors.h"
+#include "services/network/public/cpp/resource_request_body.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=RewardsNetworkDelegateHelperTest.*
+
+namespace brave_rewards {
+
+class RewardsNetworkDelegateHelperTest : public testing::Test {
+ protected:
+  std::shared_ptr<brave::BraveRequestInfo> CreateUpload(const GURL& url) {
+    // Large enough to matter when copied
+    const std::string data(1024 * 1024, 'x');
+    auto body = base::MakeRefCounted<network::ResourceRequestBody>();
+    body->AppendBytes(data.data(), data.size());
+
+    auto ctx = std::make_shared<brave::BraveRequestInfo>(url);
+    ctx->request_body = body;
+    return ctx;
+  }
+
+  content::BrowserTaskEnvironment task_environment_;
+};
+
+TEST_F(RewardsNetworkDelegateHelperTest, NonMediaUploadIsNotCopied) {
+  auto ctx = CreateUpload(GURL("https://brave.com/upload"));
+
+  EXPECT_EQ(OnBeforeURLRequest(brave::ResponseCallback(), ctx), net::OK);
+  EXPECT_EQ(ctx->upload_data_copies_for_testing(), 0u);
+}
+
+TEST_F(RewardsNetworkDelegateHelperTest, MediaUploadIsCopiedOnce) {
+  auto ctx = CreateUpload(
+      GURL("https://fresnel.vimeocdn.com/add/player-stats?id=1"));
+
+  EXPECT_EQ(OnBeforeURLRequest(brave::ResponseCallback(), ctx), net::OK);
+  EXPECT_EQ(ctx->upload_data_copies_for_testing(), 1u);
+}
+
+TEST_F(RewardsNetworkDelegateHelperTest, RequestWithoutBody) {
+  auto ctx = std::make_shared<brave::BraveRequestInfo>(
+      GURL("https://fresnel.vimeocdn.com/add/player-stats?id=1"));
+
+  EXPECT_EQ(OnBeforeURLRequest(brave::ResponseCallback(), ctx), net::OK);
+  EXPECT_EQ(ctx->upload_data_copies_for_testing(), 0u);
+}
+
+}  // namespace brave_rewards
@@ -0,0 +1,208 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/net/rewards_url_loader.h"
+
+#include <string>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/logging.h"
+#include "base/strings/string_util.h"
+#include "net/base/load_flags.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_status_code.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/resource_response.h"
+#include "services/network/public/cpp/shared_url_loader_factory.h"
+#include "services/network/public/cpp/simple_url_loader.h"
+#include "url/gurl.h"
+#include "url/url_constants.h"
+
+namespace brave_rewards {
+
+namespace {
+
+const int kRetriesCountOnNetworkChange = 1;
+
+struct EndpointPolicy {
+  const char* host;
+  const char* path_prefix;
+  // Always validate a cached response with the server, the response is
+  // polled and the server decides how long it may be used
+  bool validate_cache;
+  size_t max_body_size;
+};
+
+// The publisher list carries the banners, the balance carries the rates. Each
+// endpoint is listed for the production, staging and development servers of
+// bat-native-ledger
+const EndpointPolicy kEndpointPolicies[] = {
+  {"publishers-distro.basicattentiontoken.org",
+      "/api/v3/public/channels", true, 64 * 1024 * 1024},
+  {"publishers-staging-distro.basicattentiontoken.org",
+      "/api/v3/public/channels", true, 64 * 1024 * 1024},
+  {"creators-distro.brave.software",
+      "/api/v3/public/channels", true, 64 * 1024 * 1024},
+  {"balance.mercury.basicattentiontoken.org",
+      "/v2/wallet/", true, 1024 * 1024},
+  {"balance-staging.mercury.basicattentiontoken.org",
+      "/v2/wallet/", true, 1024 * 1024},
+  {"balance.rewards.brave.software",
+      "/v2/wallet/", true, 1024 * 1024},
+  {"grant.rewards.brave.com",
+      "/v1/promotions", true, 1024 * 1024},
+  {"grant.rewards.bravesoftware.com",
+      "/v1/promotions", true, 1024 * 1024},
+  {"grant.rewards.brave.software",
+      "/v1/promotions", true, 1024 * 1024},
+};
+
+const EndpointPolicy kDefaultPolicy = {"", "", false, 8 * 1024 * 1024};
+
+const EndpointPolicy& GetEndpointPolicy(const GURL& url) {
+  if (!url.SchemeIs(url::kHttpsScheme)) {
+    return kDefaultPolicy;
+  }
+
+  const std::string path = url.path();
+  for (const auto& policy : kEndpointPolicies) {
+    if (url.host_piece() == policy.host &&
+        base::StartsWith(path, policy.path_prefix,
+            base::CompareCase::SENSITIVE)) {
+      return policy;
+    }
+  }
+
+  return kDefaultPolicy;
+}
+
+std::string GetRequestKey(const network::ResourceRequest& request) {
+  return request.url.spec() + "\n" +
+      std::to_string(static_cast<int>(request.credentials_mode)) + "\n" +
+      request.headers.ToString();
+}
+
+std::map<std::string, std::string> GetResponseHeaders(
+    const network::SimpleURLLoader& loader) {
+  std::map<std::string, std::string> headers;
+  if (!loader.ResponseInfo() || !loader.ResponseInfo()->headers) {
+    return headers;
+  }
+
+  size_t iter = 0;
+  std::string key;
+  std::string value;
+  while (loader.ResponseInfo()->headers->EnumerateHeaderLines(
+      &iter, &key, &value)) {
+    headers[base::ToLowerASCII(key)] = value;
+  }
+
+  return headers;
+}
+
+}  // namespace
+
+RewardsURLLoader::PendingLoad::PendingLoad() = default;
+
+RewardsURLLoader::PendingLoad::~PendingLoad() = default;
+
+RewardsURLLoader::RewardsURLLoader(
+    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
+    const net::NetworkTrafficAnnotationTag& traffic_annotation)
+    : url_loader_factory_(url_loader_factory),
+      traffic_annotation_(traffic_annotation) {
+}
+
+RewardsURLLoader::~RewardsURLLoader() = default;
+
+void RewardsURLLoader::Load(
+    std::unique_ptr<network::ResourceRequest> request,
+    const std::string& content,
+    const std::string& content_type,
+    ledger::LoadURLCallback callback) {
+  DCHECK(request);
+  const EndpointPolicy& policy = GetEndpointPolicy(request->url);
+
+  std::string key;
+  if (request->method == net::HttpRequestHeaders::kGetMethod &&
+      content.empty()) {
+    key = GetRequestKey(*request);
+    auto pending_get = pending_gets_.find(key);
+    if (pending_get != pending_gets_.end()) {
+      pending_get->second->callbacks.push_back(callback);
+      return;
+    }
+  }
+
+  // The HTTP cache answers a 304 with the stored body, unless the ledger
+  // sent validators of its own
+  if (policy.validate_cache) {
+    request->load_flags |= net::LOAD_VALIDATE_CACHE;
+  }
+
+  auto pending = pending_loads_.emplace(pending_loads_.end());
+  pending->callbacks.push_back(callback);
+  pending->key = key;
+  if (!key.empty()) {
+    pending_gets_[key] = pending;
+  }
+
+  pending->loader = network::SimpleURLLoader::Create(
+      std::move(request),
+      traffic_annotation_);
+  pending->loader->SetAllowHttpErrorResults(true);
+  pending->loader->SetRetryOptions(kRetriesCountOnNetworkChange,
+      network::SimpleURLLoader::RetryMode::RETRY_ON_NETWORK_CHANGE);
+
+  if (!content.empty()) {
+    pending->loader->AttachStringForUpload(content, content_type);
+  }
+
+  // Bodies are decompressed by the network service, which also advertises
+  // gzip and br, so |max_body_size| bounds the decoded size
+  pending->loader->DownloadToString(
+      url_loader_factory_.get(),
+      base::BindOnce(&RewardsURLLoader::OnLoadComplete,
+                     base::Unretained(this),
+                     pending),
+      policy.max_body_size);
+}
+
+void RewardsURLLoader::OnLoadComplete(
+    PendingLoads::iterator pending,
+    std::unique_ptr<std::string> response_body) {
+  const network::SimpleURLLoader& loader = *pending->loader;
+
+  int response_code = -1;
+  if (loader.ResponseInfo() && loader.ResponseInfo()->headers) {
+    response_code = loader.ResponseInfo()->headers->response_code();
+  }
+
+  if (loader.NetError() == net::ERR_INSUFFICIENT_RESOURCES) {
+    LOG(ERROR) << "Response body too large for " << loader.GetFinalURL();
+    response_code = -1;
+  }
+
+  const std::string body = response_body ? std::move(*response_body) : "";
+  const std::map<std::string, std::string> headers =
+      GetResponseHeaders(loader);
+
+  const std::string key = pending->key;
+  const std::vector<ledger::LoadURLCallback> callbacks =
+      std::move(pending->callbacks);
+  if (!key.empty()) {
+    pending_gets_.erase(key);
+  }
+  pending_loads_.erase(pending);
+
+  for (const auto& callback : callbacks) {
+    callback(response_code, body, headers);
+  }
+}
+
+}  // namespace brave_rewards
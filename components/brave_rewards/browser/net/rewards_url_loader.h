@@ -0,0 +1,75 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_NET_REWARDS_URL_LOADER_H_
+#define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_NET_REWARDS_URL_LOADER_H_
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/memory/scoped_refptr.h"
+#include "bat/ledger/ledger_client.h"
+#include "net/traffic_annotation/network_traffic_annotation.h"
+
+namespace network {
+struct ResourceRequest;
+class SharedURLLoaderFactory;
+class SimpleURLLoader;
+}  // namespace network
+
+namespace brave_rewards {
+
+// Loads the URLs requested by the ledger. Identical GET requests that are in
+// flight share a single load and every body is bounded by the policy of its
+// endpoint. The endpoints that are polled (publisher list, balance and
+// promotions) always revalidate the HTTP cache, so an unchanged resource is
+// not downloaded again. Responses to conditional requests of the ledger,
+// including 304, are passed through as they are.
+class RewardsURLLoader {
+ public:
+  RewardsURLLoader(
+      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
+      const net::NetworkTrafficAnnotationTag& traffic_annotation);
+  ~RewardsURLLoader();
+
+  void Load(
+      std::unique_ptr<network::ResourceRequest> request,
+      const std::string& content,
+      const std::string& content_type,
+      ledger::LoadURLCallback callback);
+
+ private:
+  struct PendingLoad {
+    PendingLoad();
+    ~PendingLoad();
+
+    std::unique_ptr<network::SimpleURLLoader> loader;
+    std::vector<ledger::LoadURLCallback> callbacks;
+    // Empty for loads that can not be shared
+    std::string key;
+  };
+
+  using PendingLoads = std::list<PendingLoad>;
+
+  void OnLoadComplete(
+      PendingLoads::iterator pending,
+      std::unique_ptr<std::string> response_body);
+
+  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
+  const net::NetworkTrafficAnnotationTag traffic_annotation_;
+  PendingLoads pending_loads_;
+  // Shareable GET loads in flight, by request key
+  std::map<std::string, PendingLoads::iterator> pending_gets_;
+
+  DISALLOW_COPY_AND_ASSIGN(RewardsURLLoader);
+};
+
+}  // namespace brave_rewards
+
+#endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_NET_REWARDS_URL_LOADER_H_
@@ -0,0 +1,208 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/net/rewards_url_loader.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/run_loop.h"
+#include "base/test/bind_test_util.h"
+#include "base/test/task_environment.h"
+#include "net/base/load_flags.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_status_code.h"
+#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/resource_response.h"
+#include "services/network/public/cpp/url_loader_completion_status.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=RewardsURLLoaderTest.*
+
+namespace brave_rewards {
+
+namespace {
+
+const char kPublisherListUrl[] =
+    "https://publishers-distro.basicattentiontoken.org/api/v3/public/channels";
+const char kBalanceUrl[] =
+    "https://balance.mercury.basicattentiontoken.org/v2/wallet/id/balance";
+const char kOtherUrl[] = "https://ledger.mercury.basicattentiontoken.org/v2/x";
+const char kOtherHostUrl[] = "https://example.com/api/v3/public/channels";
+
+struct Response {
+  int status;
+  std::string body;
+  std::map<std::string, std::string> headers;
+};
+
+}  // namespace
+
+class RewardsURLLoaderTest : public testing::Test {
+ protected:
+  RewardsURLLoaderTest()
+      : url_loader_(
+            base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                &test_url_loader_factory_),
+            TRAFFIC_ANNOTATION_FOR_TESTS) {
+  }
+
+  void Load(
+      const std::string& url,
+      const std::string& method,
+      std::vector<Response>* responses,
+      const std::string& if_none_match = "") {
+    auto request = std::make_unique<network::ResourceRequest>();
+    request->url = GURL(url);
+    request->method = method;
+    if (!if_none_match.empty()) {
+      request->headers.SetHeader(
+          net::HttpRequestHeaders::kIfNoneMatch,
+          if_none_match);
+    }
+    const std::string content =
+        method == net::HttpRequestHeaders::kGetMethod ? "" : "{}";
+
+    url_loader_.Load(
+        std::move(request),
+        content,
+        "application/json",
+        [responses](
+            const int status,
+            const std::string& body,
+            const std::map<std::string, std::string>& headers) {
+          responses->push_back({status, body, headers});
+        });
+  }
+
+  void Get(const std::string& url, std::vector<Response>* responses) {
+    Load(url, net::HttpRequestHeaders::kGetMethod, responses);
+  }
+
+  void Respond(
+      const std::string& url,
+      const net::HttpStatusCode status,
+      const std::string& body,
+      const std::string& etag) {
+    network::ResourceResponseHead head =
+        network::CreateResourceResponseHead(status);
+    if (!etag.empty()) {
+      head.headers->AddHeader("ETag: " + etag);
+    }
+
+    test_url_loader_factory_.AddResponse(
+        GURL(url),
+        head,
+        body,
+        network::URLLoaderCompletionStatus(net::OK));
+    base::RunLoop().RunUntilIdle();
+  }
+
+  // Returns the load flags of the next request
+  int* CaptureLoadFlags() {
+    load_flags_ = 0;
+    test_url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+        [this](const network::ResourceRequest& request) {
+          load_flags_ = request.load_flags;
+        }));
+    return &load_flags_;
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  network::TestURLLoaderFactory test_url_loader_factory_;
+  RewardsURLLoader url_loader_;
+  int load_flags_;
+};
+
+TEST_F(RewardsURLLoaderTest, IdenticalGetsShareLoad) {
+  std::vector<Response> responses;
+  Get(kOtherUrl, &responses);
+  Get(kOtherUrl, &responses);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(test_url_loader_factory_.NumPending(), 1);
+
+  Respond(kOtherUrl, net::HTTP_OK, "body", "");
+  ASSERT_EQ(responses.size(), 2u);
+  for (const auto& response : responses) {
+    EXPECT_EQ(response.status, net::HTTP_OK);
+    EXPECT_EQ(response.body, "body");
+  }
+}
+
+TEST_F(RewardsURLLoaderTest, PostsAreNotShared) {
+  std::vector<Response> responses;
+  Load(kOtherUrl, net::HttpRequestHeaders::kPostMethod, &responses);
+  Load(kOtherUrl, net::HttpRequestHeaders::kPostMethod, &responses);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(test_url_loader_factory_.NumPending(), 2);
+}
+
+TEST_F(RewardsURLLoaderTest, PolledEndpointsValidateCache) {
+  std::vector<Response> responses;
+  int* load_flags = CaptureLoadFlags();
+  Get(kPublisherListUrl, &responses);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(*load_flags & net::LOAD_VALIDATE_CACHE);
+
+  load_flags = CaptureLoadFlags();
+  Get(kBalanceUrl, &responses);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(*load_flags & net::LOAD_VALIDATE_CACHE);
+}
+
+TEST_F(RewardsURLLoaderTest, OtherEndpointsDoNotValidateCache) {
+  std::vector<Response> responses;
+  int* load_flags = CaptureLoadFlags();
+  Get(kOtherUrl, &responses);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_FALSE(*load_flags & net::LOAD_VALIDATE_CACHE);
+}
+
+TEST_F(RewardsURLLoaderTest, OtherHostsDoNotValidateCache) {
+  std::vector<Response> responses;
+  int* load_flags = CaptureLoadFlags();
+  Get(kOtherHostUrl, &responses);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_FALSE(*load_flags & net::LOAD_VALIDATE_CACHE);
+}
+
+TEST_F(RewardsURLLoaderTest, NotModifiedIsPassedThrough) {
+  std::vector<Response> responses;
+  Load(kPublisherListUrl, net::HttpRequestHeaders::kGetMethod, &responses,
+      "\"v1\"");
+  Respond(kPublisherListUrl, net::HTTP_NOT_MODIFIED, "", "\"v1\"");
+
+  ASSERT_EQ(responses.size(), 1u);
+  EXPECT_EQ(responses[0].status, net::HTTP_NOT_MODIFIED);
+  EXPECT_TRUE(responses[0].body.empty());
+  EXPECT_EQ(responses[0].headers["etag"], "\"v1\"");
+}
+
+TEST_F(RewardsURLLoaderTest, ConditionalGetsAreNotSharedWithOthers) {
+  std::vector<Response> responses;
+  Get(kPublisherListUrl, &responses);
+  Load(kPublisherListUrl, net::HttpRequestHeaders::kGetMethod, &responses,
+      "\"v1\"");
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(test_url_loader_factory_.NumPending(), 2);
+}
+
+TEST_F(RewardsURLLoaderTest, BodyIsBounded) {
+  std::vector<Response> responses;
+  Get(kBalanceUrl, &responses);
+  Respond(kBalanceUrl, net::HTTP_OK, std::string(2 * 1024 * 1024, 'x'), "");
+
+  ASSERT_EQ(responses.size(), 1u);
+  EXPECT_EQ(responses[0].status, -1);
+  EXPECT_TRUE(responses[0].body.empty());
+}
+
+}  // namespace brave_rewards
@@ -59,12 +59,14 @@ void RewardsService::RegisterProfilePrefs(PrefRegistrySimple* registry) {
   registry->RegisterBooleanPref(prefs::kBraveRewardsEnabledMigrated, false);
   registry->RegisterDictionaryPref(prefs::kRewardsExternalWallets);
   registry->RegisterUint64Pref(prefs::kStateServerPublisherListStamp, 0ull);
+  registry->RegisterStringPref(prefs::kStateServerPublisherListETag, "");
   registry->RegisterStringPref(prefs::kStateUpholdAnonAddress, "");
   registry->RegisterStringPref(prefs::kRewardsBadgeText, "1");
 #if defined(OS_ANDROID)
   registry->RegisterBooleanPref(prefs::kUseRewardsStagingServer, false);
 #endif
   registry->RegisterUint64Pref(prefs::kStatePromotionLastFetchStamp, 0ull);
+  registry->RegisterStringPref(prefs::kStateMediaPublisherCache, "");
 }
 
 }  // namespace brave_rewards
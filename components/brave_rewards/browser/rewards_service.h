@@ -53,6 +53,8 @@ class RewardsServicePrivateObserver;
 using GetContentSiteListCallback =
     base::Callback<void(std::unique_ptr<ContentSiteList>,
         uint32_t /* next_record */)>;
+using GetContentSitePageCallback =
+    base::OnceCallback<void(std::unique_ptr<ContentSitePage>)>;
 using GetWalletPassphraseCallback = base::Callback<void(const std::string&)>;
 using GetContributionAmountCallback = base::Callback<void(double)>;
 using GetAutoContributePropsCallback = base::Callback<void(
@@ -131,6 +133,15 @@ class RewardsService : public KeyedService {
       uint32_t min_visits,
       bool fetch_excluded,
       const GetContentSiteListCallback& callback) = 0;
+  // Reads up to |limit| auto-contribute sites which come after |cursor|
+  virtual void GetContentSitePage(
+      const ContentSiteCursor& cursor,
+      uint32_t limit,
+      uint64_t min_visit_time,
+      uint64_t reconcile_stamp,
+      bool allow_non_verified,
+      uint32_t min_visits,
+      GetContentSitePageCallback callback) = 0;
   virtual void FetchPromotions() = 0;
   // Used by desktop
   virtual void ClaimPromotion(ClaimPromotionCallback callback) = 0;
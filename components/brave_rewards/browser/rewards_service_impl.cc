@@ -32,6 +32,7 @@
 #include "base/task/post_task.h"
 #include "base/task_runner_util.h"
 #include "base/threading/sequenced_task_runner_handle.h"
+#include "base/timer/timer.h"
 #include "bat/ledger/ledger.h"
 #include "bat/ledger/global_constants.h"
 #include "bat/ledger/mojom_structs.h"
@@ -48,8 +49,10 @@
 #include "brave/components/brave_rewards/browser/auto_contribution_props.h"
 #include "brave/components/brave_rewards/browser/balance_report.h"
 #include "brave/components/brave_rewards/browser/content_site.h"
+#include "brave/components/brave_rewards/browser/media_request_batcher.h"
 #include "brave/components/brave_rewards/browser/publisher_banner.h"
 #include "brave/components/brave_rewards/browser/database/publisher_info_database.h"
+#include "brave/components/brave_rewards/browser/net/rewards_url_loader.h"
 #include "brave/components/brave_rewards/browser/rewards_fetcher_service_observer.h"
 #include "brave/components/brave_rewards/browser/rewards_notification_service.h"
 #include "brave/components/brave_rewards/browser/rewards_notification_service_impl.h"
@@ -78,7 +81,7 @@
 #include "net/base/url_util.h"
 #include "net/http/http_status_code.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
-#include "services/network/public/cpp/simple_url_loader.h"
+#include "services/network/public/cpp/resource_request.h"
 #include "services/service_manager/public/cpp/connector.h"
 #include "ui/base/resource/resource_bundle.h"
 #include "ui/gfx/image/image.h"
@@ -100,11 +103,10 @@
 using net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES;
 using std::placeholders::_1;
 using std::placeholders::_2;
+using std::placeholders::_3;
 
 namespace brave_rewards {
 
-static const unsigned int kRetriesCountOnNetworkChange = 1;
-
 class LogStreamImpl : public ledger::LogStream {
  public:
   LogStreamImpl(const char* file,
@@ -303,6 +305,36 @@ ledger::PublisherInfoList GetActivityListOnFileTaskRunner(
   return list;
 }
 
+std::unique_ptr<ContentSitePage> GetContentSitePageOnFileTaskRunner(
+    const ContentSiteCursor& cursor,
+    uint32_t limit,
+    ledger::ActivityInfoFilterPtr filter,
+    PublisherInfoDatabase* backend) {
+  auto page = std::make_unique<ContentSitePage>();
+  if (!backend || filter.is_null())
+    return page;
+
+  page->total = std::max(backend->GetActivityListCount(filter->Clone()), 0);
+
+  ledger::PublisherInfoList list;
+  if (!backend->GetActivityListPage(std::move(filter), cursor.percentage,
+      cursor.id, limit, &list)) {
+    return page;
+  }
+
+  for (const auto& publisher : list) {
+    page->list.push_back(PublisherInfoToContentSite(*publisher));
+  }
+
+  // A full page means there may be more rows after the last one
+  if (!list.empty() && list.size() == limit) {
+    page->next.percentage = list.back()->percent;
+    page->next.id = list.back()->id;
+  }
+
+  return page;
+}
+
 ledger::PublisherInfoPtr GetPanelPublisherInfoOnFileTaskRunner(
     ledger::ActivityInfoFilterPtr filter,
     PublisherInfoDatabase* backend) {
@@ -412,6 +444,32 @@ net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTagForURLLoad() {
 
 const char pref_prefix[] = "brave.rewards.";
 
+const int kDatabasePageSize = 4096;
+const int kDatabaseCacheSizeInPages = 2000;
+const int64_t kDatabaseMmapSize = 32 * 1024 * 1024;
+// Maintenance runs once the user has been idle this long, checked at
+// |kDatabaseIdlePollInterval|
+const int kDatabaseMaintenanceIdleThreshold = 5 * 60;
+constexpr base::TimeDelta kDatabaseIdlePollInterval =
+    base::TimeDelta::FromMinutes(1);
+
+// Ledger state is saved after almost every change, often several times in a
+// row while a contribution is processed
+constexpr base::TimeDelta kLedgerStateCommitInterval =
+    base::TimeDelta::FromSeconds(1);
+
+bool InitPublisherInfoDatabaseOnFileTaskRunner(
+    PublisherInfoDatabase* backend) {
+  return backend && backend->Init();
+}
+
+void RunPublisherInfoDatabaseMaintenanceOnFileTaskRunner(
+    PublisherInfoDatabase* backend) {
+  if (backend) {
+    backend->RunMaintenance();
+  }
+}
+
 }  // namespace
 
 bool IsMediaLink(const GURL& url,
@@ -456,16 +514,27 @@ RewardsServiceImpl::RewardsServiceImpl(Profile* profile)
       rewards_base_path_(profile_->GetPath().Append(kRewardsStatePath)),
       publisher_info_backend_(
           new PublisherInfoDatabase(publisher_info_db_path_)),
+      publisher_info_reader_ready_(false),
+      last_database_idle_state_(ui::IdleState::IDLE_STATE_ACTIVE),
       notification_service_(new RewardsNotificationServiceImpl(profile)),
 #if BUILDFLAG(ENABLE_EXTENSIONS)
       private_observer_(
           std::make_unique<ExtensionRewardsServiceObserver>(profile_)),
 #endif
+      media_request_batcher_(std::make_unique<MediaRequestBatcher>(
+          base::BindRepeating(&RewardsServiceImpl::OnMediaRequestsBatched,
+                              AsWeakPtr()))),
       next_timer_id_(0),
       reset_states_(false) {
   file_task_runner_->PostTask(
       FROM_HERE, base::BindOnce(&EnsureRewardsBaseDirectoryExists,
                                 rewards_base_path_));
+
+  if (base::CommandLine::ForCurrentProcess()->HasSwitch(
+      switches::kRewardsDatabaseTuning)) {
+    InitPublisherInfoReader();
+  }
+
   // Set up the rewards data source
   content::URLDataSource::Add(profile_,
                               std::make_unique<BraveRewardsSource>(profile_));
@@ -473,9 +542,108 @@ RewardsServiceImpl::RewardsServiceImpl(Profile* profile)
 
 RewardsServiceImpl::~RewardsServiceImpl() {
   file_task_runner_->DeleteSoon(FROM_HERE, publisher_info_backend_.release());
+  if (read_task_runner_) {
+    read_task_runner_->DeleteSoon(FROM_HERE, publisher_info_reader_.release());
+  }
   StopNotificationTimers();
 }
 
+void RewardsServiceImpl::InitPublisherInfoReader() {
+  PublisherInfoDatabaseTuning tuning;
+  tuning.wal_mode = true;
+  tuning.page_size = kDatabasePageSize;
+  tuning.cache_size = kDatabaseCacheSizeInPages;
+  tuning.mmap_size = kDatabaseMmapSize;
+
+  // Not yet initialized, so this is safe to do from here
+  publisher_info_backend_->set_tuning(tuning);
+
+  read_task_runner_ = base::CreateSequencedTaskRunner(
+      {base::ThreadPool(), base::MayBlock(),
+       base::TaskPriority::USER_VISIBLE,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN});
+  publisher_info_reader_ =
+      std::make_unique<PublisherInfoDatabase>(publisher_info_db_path_);
+  publisher_info_reader_->set_tuning(tuning);
+  publisher_info_reader_->set_read_only(true);
+
+  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
+      base::BindOnce(&InitPublisherInfoDatabaseOnFileTaskRunner,
+                     publisher_info_backend_.get()),
+      base::BindOnce(&RewardsServiceImpl::OnPublisherInfoDatabaseInitialized,
+                     AsWeakPtr()));
+}
+
+void RewardsServiceImpl::OnPublisherInfoDatabaseInitialized(bool success) {
+  if (!success) {
+    return;
+  }
+
+  publisher_info_reader_ready_ = true;
+
+#if defined(OS_ANDROID)
+  // Android has no user idle time, the app going to the background is the
+  // closest equivalent
+  app_status_listener_ = base::android::ApplicationStatusListener::New(
+      base::BindRepeating(&RewardsServiceImpl::OnApplicationStateChange,
+      AsWeakPtr()));
+#else
+  database_idle_poll_timer_ = std::make_unique<base::RepeatingTimer>();
+  database_idle_poll_timer_->Start(
+      FROM_HERE,
+      kDatabaseIdlePollInterval,
+      this,
+      &RewardsServiceImpl::CheckDatabaseIdleState);
+#endif
+}
+
+#if defined(OS_ANDROID)
+void RewardsServiceImpl::OnApplicationStateChange(
+    base::android::ApplicationState state) {
+  // Once each time the user leaves the app
+  if (state == base::android::APPLICATION_STATE_HAS_STOPPED_ACTIVITIES) {
+    RunDatabaseMaintenance();
+  }
+}
+#endif
+
+void RewardsServiceImpl::CheckDatabaseIdleState() {
+  const ui::IdleState idle_state =
+      ui::CalculateIdleState(kDatabaseMaintenanceIdleThreshold);
+  if (idle_state == last_database_idle_state_) {
+    return;
+  }
+
+  last_database_idle_state_ = idle_state;
+
+  // Once per idle period, when the user stops browsing
+  if (idle_state != ui::IdleState::IDLE_STATE_ACTIVE) {
+    RunDatabaseMaintenance();
+  }
+}
+
+void RewardsServiceImpl::RunDatabaseMaintenance() {
+  file_task_runner_->PostTask(FROM_HERE,
+      base::BindOnce(&RunPublisherInfoDatabaseMaintenanceOnFileTaskRunner,
+                     publisher_info_backend_.get()));
+}
+
+base::SequencedTaskRunner* RewardsServiceImpl::GetReadTaskRunner() {
+  if (publisher_info_reader_ready_) {
+    return read_task_runner_.get();
+  }
+
+  return file_task_runner_.get();
+}
+
+PublisherInfoDatabase* RewardsServiceImpl::GetReadBackend() {
+  if (publisher_info_reader_ready_) {
+    return publisher_info_reader_.get();
+  }
+
+  return publisher_info_backend_.get();
+}
+
 void RewardsServiceImpl::ConnectionClosed() {
   base::ThreadTaskRunnerHandle::Get()->PostDelayedTask(FROM_HERE,
       base::BindOnce(&RewardsServiceImpl::StartLedger, AsWeakPtr()),
@@ -689,10 +857,50 @@ void RewardsServiceImpl::OnGetContentSiteList(
   callback.Run(std::move(site_list), next_record);
 }
 
+void RewardsServiceImpl::GetContentSitePage(
+    const ContentSiteCursor& cursor,
+    uint32_t limit,
+    uint64_t min_visit_time,
+    uint64_t reconcile_stamp,
+    bool allow_non_verified,
+    uint32_t min_visits,
+    GetContentSitePageCallback callback) {
+  auto filter = ledger::ActivityInfoFilter::New();
+  filter->min_duration = min_visit_time;
+  filter->reconcile_stamp = reconcile_stamp;
+  filter->excluded = ledger::ExcludeFilter::FILTER_ALL_EXCEPT_EXCLUDED;
+  filter->percent = 1;
+  filter->non_verified = allow_non_verified;
+  filter->min_visits = min_visits;
+
+  // The database lives in this process, so pages are read straight from it
+  // instead of being copied through the ledger and back. Only the rewards
+  // page shows these, so a page may miss writes still queued on the file
+  // task runner until it is next refreshed
+  base::PostTaskAndReplyWithResult(GetReadTaskRunner(), FROM_HERE,
+      base::BindOnce(&GetContentSitePageOnFileTaskRunner,
+                     cursor,
+                     limit,
+                     std::move(filter),
+                     GetReadBackend()),
+      base::BindOnce(&RewardsServiceImpl::OnGetContentSitePage,
+                     AsWeakPtr(),
+                     std::move(callback)));
+}
+
+void RewardsServiceImpl::OnGetContentSitePage(
+    GetContentSitePageCallback callback,
+    std::unique_ptr<ContentSitePage> page) {
+  std::move(callback).Run(std::move(page));
+}
+
 void RewardsServiceImpl::OnLoad(SessionID tab_id, const GURL& url) {
   if (!Connected())
     return;
 
+  // Pending media requests belong to the previous page
+  media_request_batcher_->Flush(tab_id);
+
   auto origin = url.GetOrigin();
   const std::string baseDomain =
       GetDomainAndRegistry(origin.host(), INCLUDE_PRIVATE_REGISTRIES);
@@ -715,6 +923,7 @@ void RewardsServiceImpl::OnUnload(SessionID tab_id) {
   if (!Connected())
     return;
 
+  media_request_batcher_->Flush(tab_id);
   bat_ledger_->OnUnload(tab_id.id(), GetCurrentTimestamp());
 }
 
@@ -729,6 +938,7 @@ void RewardsServiceImpl::OnHide(SessionID tab_id) {
   if (!Connected())
     return;
 
+  media_request_batcher_->Flush(tab_id);
   bat_ledger_->OnHide(tab_id.id(), GetCurrentTimestamp());
 }
 
@@ -743,6 +953,7 @@ void RewardsServiceImpl::OnBackground(SessionID tab_id) {
   if (!Connected())
     return;
 
+  media_request_batcher_->Flush(tab_id);
   bat_ledger_->OnBackground(tab_id.id(), GetCurrentTimestamp());
 }
 
@@ -770,11 +981,14 @@ void RewardsServiceImpl::OnPostData(SessionID tab_id,
   data->path = url.spec(),
   data->tab_id = tab_id.id();
 
-  bat_ledger_->OnPostData(url.spec(),
-                          first_party_url.spec(),
-                          referrer.spec(),
-                          output,
-                          std::move(data));
+  auto request = ledger::MediaRequest::New();
+  request->type = ledger::MediaRequestType::POST_DATA;
+  request->url = url.spec();
+  request->post_data = output;
+  request->first_party_url = first_party_url.spec();
+  request->referrer = referrer.spec();
+  request->visit_data = std::move(data);
+  media_request_batcher_->Add(tab_id, std::move(request));
 }
 
 void RewardsServiceImpl::OnXHRLoad(SessionID tab_id,
@@ -794,12 +1008,23 @@ void RewardsServiceImpl::OnXHRLoad(SessionID tab_id,
   data->path = url.spec();
   data->tab_id = tab_id.id();
 
-  bat_ledger_->OnXHRLoad(tab_id.id(),
-                         url.spec(),
-                         base::MapToFlatMap(parts),
-                         first_party_url.spec(),
-                         referrer.spec(),
-                         std::move(data));
+  auto request = ledger::MediaRequest::New();
+  request->type = ledger::MediaRequestType::XHR_LOAD;
+  request->url = url.spec();
+  request->parts = base::MapToFlatMap(parts);
+  request->first_party_url = first_party_url.spec();
+  request->referrer = referrer.spec();
+  request->visit_data = std::move(data);
+  media_request_batcher_->Add(tab_id, std::move(request));
+}
+
+void RewardsServiceImpl::OnMediaRequestsBatched(
+    ledger::MediaRequestList requests) {
+  if (!Connected()) {
+    return;
+  }
+
+  bat_ledger_->OnMediaRequests(std::move(requests));
 }
 
 void RewardsServiceImpl::LoadPublisherInfo(
@@ -910,11 +1135,13 @@ void RewardsServiceImpl::Shutdown() {
     }
   }
 
-  for (auto* const loader : url_loaders_) {
-    delete loader;
+  url_loader_.reset();
+
+  if (ledger_state_writer_ && ledger_state_writer_->HasPendingWrite()) {
+    ledger_state_writer_->DoScheduledWrite();
   }
-  url_loaders_.clear();
 
+  media_request_batcher_->FlushAll();
   bat_ledger_.reset();
   RewardsService::Shutdown();
 }
@@ -1051,6 +1278,13 @@ void RewardsServiceImpl::OnReconcileComplete(
                                  static_cast<int>(type));
 }
 
+void RewardsServiceImpl::OnBallotProofProgress(
+    const uint32_t done,
+    const uint32_t total) {
+  for (auto& observer : observers_)
+    observer.OnBallotProofProgress(this, done, total);
+}
+
 void RewardsServiceImpl::LoadLedgerState(
     ledger::OnLoadCallback callback) {
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
@@ -1122,28 +1356,46 @@ void RewardsServiceImpl::SaveLedgerState(const std::string& ledger_state,
   if (reset_states_) {
     return;
   }
-  base::ImportantFileWriter writer(
-      ledger_state_path_, file_task_runner_);
 
-  writer.RegisterOnNextWriteCallbacks(
+  if (!ledger_state_writer_) {
+    ledger_state_writer_ = std::make_unique<base::ImportantFileWriter>(
+        ledger_state_path_,
+        file_task_runner_,
+        kLedgerStateCommitInterval);
+  }
+
+  // Only the latest state is written, every handler is told once the write
+  // that includes its state is done
+  ledger_state_ = ledger_state;
+  ledger_state_handlers_.push_back(handler);
+  ledger_state_writer_->ScheduleWrite(this);
+}
+
+bool RewardsServiceImpl::SerializeData(std::string* data) {
+  DCHECK(data);
+  *data = ledger_state_;
+
+  ledger_state_writer_->RegisterOnNextWriteCallbacks(
       base::Closure(),
       base::Bind(
         &PostWriteCallback,
         base::Bind(&RewardsServiceImpl::OnLedgerStateSaved, AsWeakPtr(),
-            base::Unretained(handler)),
+            ledger_state_handlers_),
         base::SequencedTaskRunnerHandle::Get()));
-
-  writer.WriteNow(std::make_unique<std::string>(ledger_state));
+  ledger_state_handlers_.clear();
+  return true;
 }
 
 void RewardsServiceImpl::OnLedgerStateSaved(
-    ledger::LedgerCallbackHandler* handler,
+    const std::vector<ledger::LedgerCallbackHandler*>& handlers,
     bool success) {
   if (!Connected())
     return;
 
-  handler->OnLedgerStateSaved(success ? ledger::Result::LEDGER_OK
-                                      : ledger::Result::NO_LEDGER_STATE);
+  for (auto* handler : handlers) {
+    handler->OnLedgerStateSaved(success ? ledger::Result::LEDGER_OK
+                                        : ledger::Result::NO_LEDGER_STATE);
+  }
 }
 
 void RewardsServiceImpl::SavePublisherState(const std::string& publisher_state,
@@ -1399,16 +1651,6 @@ void RewardsServiceImpl::LoadURL(
 
   for (size_t i = 0; i < headers.size(); i++)
     request->headers.AddHeaderFromString(headers[i]);
-  network::SimpleURLLoader* loader = network::SimpleURLLoader::Create(
-      std::move(request),
-      GetNetworkTrafficAnnotationTagForURLLoad()).release();
-  loader->SetAllowHttpErrorResults(true);
-  url_loaders_.insert(loader);
-  loader->SetRetryOptions(kRetriesCountOnNetworkChange,
-      network::SimpleURLLoader::RetryMode::RETRY_ON_NETWORK_CHANGE);
-
-  if (!content.empty())
-    loader->AttachStringForUpload(content, contentType);
 
   if (VLOG_IS_ON(ledger::LogLevel::LOG_REQUEST)) {
     std::string headers_log = "";
@@ -1417,47 +1659,32 @@ void RewardsServiceImpl::LoadURL(
     }
   }
 
-  loader->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
-      content::BrowserContext::GetDefaultStoragePartition(profile_)
-          ->GetURLLoaderFactoryForBrowserProcess().get(),
-      base::BindOnce(&RewardsServiceImpl::OnURLLoaderComplete,
-                     base::Unretained(this),
-                     loader,
-                     callback));
+  if (!url_loader_) {
+    url_loader_ = std::make_unique<RewardsURLLoader>(
+        content::BrowserContext::GetDefaultStoragePartition(profile_)
+            ->GetURLLoaderFactoryForBrowserProcess(),
+        GetNetworkTrafficAnnotationTagForURLLoad());
+  }
+
+  url_loader_->Load(
+      std::move(request),
+      content,
+      contentType,
+      std::bind(&RewardsServiceImpl::OnURLLoaded,
+                this,
+                callback,
+                _1,
+                _2,
+                _3));
 }
 
-void RewardsServiceImpl::OnURLLoaderComplete(
-    network::SimpleURLLoader* loader,
+void RewardsServiceImpl::OnURLLoaded(
     ledger::LoadURLCallback callback,
-    std::unique_ptr<std::string> response_body) {
-  DCHECK(url_loaders_.find(loader) != url_loaders_.end());
-  url_loaders_.erase(loader);
-  std::unique_ptr<network::SimpleURLLoader> scoped_loader(loader);
-
-  int response_code = -1;
-  if (loader->ResponseInfo() && loader->ResponseInfo()->headers)
-    response_code = loader->ResponseInfo()->headers->response_code();
-
-  std::map<std::string, std::string> headers;
-  if (loader->ResponseInfo()) {
-    scoped_refptr<net::HttpResponseHeaders> headersList =
-        loader->ResponseInfo()->headers;
-
-    if (headersList) {
-      size_t iter = 0;
-      std::string key;
-      std::string value;
-      while (headersList->EnumerateHeaderLines(&iter, &key, &value)) {
-        key = base::ToLowerASCII(key);
-        headers[key] = value;
-      }
-    }
-  }
-
+    const int response_status_code,
+    const std::string& response,
+    const std::map<std::string, std::string>& headers) {
   if (Connected()) {
-    callback(response_code,
-             response_body ? *response_body : std::string(),
-             headers);
+    callback(response_status_code, response, headers);
   }
 }
 
@@ -1868,6 +2095,12 @@ void RewardsServiceImpl::ResetState(
 
 void RewardsServiceImpl::ResetTheWholeState(
     const base::Callback<void(bool)>& callback) {
+  // Writes are sequenced on |file_task_runner_|, so the state written here
+  // is deleted below
+  if (ledger_state_writer_ && ledger_state_writer_->HasPendingWrite()) {
+    ledger_state_writer_->DoScheduledWrite();
+  }
+
   reset_states_ = true;
   notification_service_->DeleteAllNotifications();
   std::vector<base::FilePath> paths;
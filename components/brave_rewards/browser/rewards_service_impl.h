@@ -13,9 +13,9 @@
 #include <utility>
 #include <vector>
 
-#include "base/containers/flat_set.h"
 #include "bat/ledger/ledger.h"
 #include "base/files/file_path.h"
+#include "base/files/important_file_writer.h"
 #include "base/observer_list.h"
 #include "base/one_shot_event.h"
 #include "base/memory/weak_ptr.h"
@@ -29,6 +29,7 @@
 #include "mojo/public/cpp/bindings/remote.h"
 #include "brave/components/brave_rewards/browser/balance_report.h"
 #include "brave/components/brave_rewards/browser/content_site.h"
+#include "ui/base/idle/idle.h"
 #include "ui/gfx/image/image.h"
 #include "brave/components/brave_rewards/browser/publisher_banner.h"
 #include "brave/components/brave_rewards/browser/rewards_service_private_observer.h"
@@ -37,6 +38,10 @@
 #include "brave/components/brave_rewards/browser/extension_rewards_service_observer.h"
 #endif
 
+#if defined(OS_ANDROID)
+#include "base/android/application_status_listener.h"
+#endif
+
 #if defined(OS_ANDROID) && defined(BRAVE_CHROMIUM_BUILD)
 #include "brave/components/brave_rewards/browser/android/safetynet_check.h"
 #elif defined(OS_ANDROID)
@@ -59,18 +64,16 @@ namespace leveldb {
 class DB;
 }  // namespace leveldb
 
-namespace network {
-class SimpleURLLoader;
-}  // namespace network
-
 
 class Profile;
 class BraveRewardsBrowserTest;
 
 namespace brave_rewards {
 
+class MediaRequestBatcher;
 class PublisherInfoDatabase;
 class RewardsNotificationServiceImpl;
+class RewardsURLLoader;
 class BraveRewardsBrowserTest;
 
 using GetEnvironmentCallback = base::Callback<void(ledger::Environment)>;
@@ -91,6 +94,7 @@ using ExternalWalletAuthorizationCallback =
 
 class RewardsServiceImpl : public RewardsService,
                            public ledger::LedgerClient,
+                           public base::ImportantFileWriter::DataSerializer,
                            public base::SupportsWeakPtr<RewardsServiceImpl> {
  public:
   explicit RewardsServiceImpl(Profile* profile);
@@ -128,6 +132,17 @@ class RewardsServiceImpl : public RewardsService,
       const GetContentSiteListCallback& callback,
       ledger::PublisherInfoList list,
       uint32_t next_record);
+  void GetContentSitePage(
+      const ContentSiteCursor& cursor,
+      uint32_t limit,
+      uint64_t min_visit_time,
+      uint64_t reconcile_stamp,
+      bool allow_non_verified,
+      uint32_t min_visits,
+      GetContentSitePageCallback callback) override;
+  void OnGetContentSitePage(
+      GetContentSitePageCallback callback,
+      std::unique_ptr<ContentSitePage> page);
   void OnLoad(SessionID tab_id, const GURL& url) override;
   void OnUnload(SessionID tab_id) override;
   void OnShow(SessionID tab_id) override;
@@ -322,8 +337,9 @@ class RewardsServiceImpl : public RewardsService,
 
   void OnCreateWallet(CreateWalletCallback callback,
                       ledger::Result result);
-  void OnLedgerStateSaved(ledger::LedgerCallbackHandler* handler,
-                          bool success);
+  void OnLedgerStateSaved(
+      const std::vector<ledger::LedgerCallbackHandler*>& handlers,
+      bool success);
   void OnLedgerStateLoaded(ledger::OnLoadCallback callback,
                               std::pair<std::string, base::Value> data);
   void LoadNicewareList(ledger::GetNicewareListCallback callback) override;
@@ -444,12 +460,31 @@ class RewardsServiceImpl : public RewardsService,
     ledger::PendingContributionInfoListCallback callback,
     ledger::PendingContributionInfoList list);
 
-  void OnURLLoaderComplete(network::SimpleURLLoader* loader,
-                           ledger::LoadURLCallback callback,
-                           std::unique_ptr<std::string> response_body);
+  void OnURLLoaded(
+      ledger::LoadURLCallback callback,
+      const int response_status_code,
+      const std::string& response,
+      const std::map<std::string, std::string>& headers);
+
+  void InitPublisherInfoReader();
+  void OnPublisherInfoDatabaseInitialized(bool success);
+  void CheckDatabaseIdleState();
+#if defined(OS_ANDROID)
+  void OnApplicationStateChange(base::android::ApplicationState state);
+#endif
+  void RunDatabaseMaintenance();
+  // Read-only queries go to the reader connection once the writer has
+  // finished migrating the schema, and to the writer otherwise. The reader
+  // is not ordered after writes queued on |file_task_runner_|, so it is only
+  // used for UI reads which may be stale. Reads made for the ledger, which
+  // expects to see its own writes, always go through |file_task_runner_|
+  base::SequencedTaskRunner* GetReadTaskRunner();
+  PublisherInfoDatabase* GetReadBackend();
 
   void StartNotificationTimers(bool main_enabled);
   void StopNotificationTimers();
+
+  void OnMediaRequestsBatched(ledger::MediaRequestList requests);
   void OnNotificationTimerFired();
 
   void MaybeShowNotificationAddFunds();
@@ -536,6 +571,9 @@ class RewardsServiceImpl : public RewardsService,
       const std::string& viewing_id,
       const double amount,
       const ledger::RewardsType type) override;
+  void OnBallotProofProgress(
+      const uint32_t done,
+      const uint32_t total) override;
   void OnAttestPromotion(
       AttestPromotionCallback callback,
       const ledger::Result result,
@@ -546,6 +584,9 @@ class RewardsServiceImpl : public RewardsService,
                        ledger::LedgerCallbackHandler* handler) override;
   void SavePublisherState(const std::string& publisher_state,
                           ledger::LedgerCallbackHandler* handler) override;
+
+  // base::ImportantFileWriter::DataSerializer
+  bool SerializeData(std::string* data) override;
   void SavePublisherInfo(ledger::PublisherInfoPtr publisher_info,
                          ledger::PublisherInfoCallback callback) override;
   void SaveActivityInfo(ledger::PublisherInfoPtr publisher_info,
@@ -896,11 +937,25 @@ class RewardsServiceImpl : public RewardsService,
 #endif
   const scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
   const base::FilePath ledger_state_path_;
+  // Coalesces the ledger state saves of a burst into a single write
+  std::unique_ptr<base::ImportantFileWriter> ledger_state_writer_;
+  std::string ledger_state_;
+  // Waiting for the scheduled write of |ledger_state_|
+  std::vector<ledger::LedgerCallbackHandler*> ledger_state_handlers_;
   const base::FilePath publisher_state_path_;
   const base::FilePath publisher_info_db_path_;
   const base::FilePath publisher_list_path_;
   const base::FilePath rewards_base_path_;
   std::unique_ptr<PublisherInfoDatabase> publisher_info_backend_;
+  scoped_refptr<base::SequencedTaskRunner> read_task_runner_;
+  std::unique_ptr<PublisherInfoDatabase> publisher_info_reader_;
+  bool publisher_info_reader_ready_;
+  std::unique_ptr<base::RepeatingTimer> database_idle_poll_timer_;
+  ui::IdleState last_database_idle_state_;
+#if defined(OS_ANDROID)
+  std::unique_ptr<base::android::ApplicationStatusListener>
+      app_status_listener_;
+#endif
   std::unique_ptr<RewardsNotificationServiceImpl> notification_service_;
   base::ObserverList<RewardsServicePrivateObserver> private_observers_;
 #if BUILDFLAG(ENABLE_EXTENSIONS)
@@ -908,12 +963,15 @@ class RewardsServiceImpl : public RewardsService,
 #endif
 
   base::OneShotEvent ready_;
-  base::flat_set<network::SimpleURLLoader*> url_loaders_;
+  std::unique_ptr<RewardsURLLoader> url_loader_;
   std::map<uint32_t, std::unique_ptr<base::OneShotTimer>> timers_;
   std::vector<std::string> current_media_fetchers_;
   std::vector<BitmapFetcherService::RequestId> request_ids_;
   std::unique_ptr<base::OneShotTimer> notification_startup_timer_;
   std::unique_ptr<base::RepeatingTimer> notification_periodic_timer_;
+  // Media pings are sent to the ledger in batches, a tab is flushed before
+  // it is hidden, navigated or closed
+  std::unique_ptr<MediaRequestBatcher> media_request_batcher_;
 
   uint32_t next_timer_id_;
   bool reset_states_;
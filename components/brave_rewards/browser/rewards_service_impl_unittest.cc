@@ -5,6 +5,7 @@
 
 #include <map>
 
+#include "base/files/file_util.h"
 #include "base/files/scoped_temp_dir.h"
 #include "brave/components/brave_rewards/browser/wallet_properties.h"
 #include "brave/components/brave_rewards/browser/rewards_service_factory.h"
@@ -79,12 +80,16 @@ class RewardsServiceTest : public testing::Test {
   Profile* profile() { return profile_.get(); }
   RewardsServiceImpl* rewards_service() { return rewards_service_; }
   MockRewardsServiceObserver* observer() { return observer_.get(); }
+  content::BrowserTaskEnvironment* task_environment() {
+    return &task_environment_;
+  }
 
  private:
   // Need this as a very first member to run tests in UI thread
   // When this is set, class should not install any other MessageLoops, like
   // base::test::ScopedTaskEnvironment
-  content::BrowserTaskEnvironment task_environment_;
+  content::BrowserTaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   std::unique_ptr<Profile> profile_;
   RewardsServiceImpl* rewards_service_;
   std::unique_ptr<MockRewardsServiceObserver> observer_;
@@ -98,6 +103,25 @@ TEST_F(RewardsServiceTest, OnWalletProperties) {
   rewards_service()->OnWalletProperties(ledger::Result::LEDGER_ERROR, nullptr);
 }
 
+TEST_F(RewardsServiceTest, LedgerStateSavesAreCoalesced) {
+  ledger::LedgerClient* client = rewards_service();
+  ledger::LedgerCallbackHandler handler;
+  client->SaveLedgerState("{\"state\":1}", &handler);
+  client->SaveLedgerState("{\"state\":2}", &handler);
+  task_environment()->RunUntilIdle();
+
+  const base::FilePath path =
+      profile()->GetPath().Append(FILE_PATH_LITERAL("ledger_state"));
+  EXPECT_FALSE(base::PathExists(path));
+
+  task_environment()->FastForwardBy(base::TimeDelta::FromSeconds(1));
+  task_environment()->RunUntilIdle();
+
+  std::string data;
+  ASSERT_TRUE(base::ReadFileToString(path, &data));
+  EXPECT_EQ(data, "{\"state\":2}");
+}
+
 // add test for strange entries
 
 }  // namespace brave_rewards
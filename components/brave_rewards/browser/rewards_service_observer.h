@@ -56,6 +56,10 @@ class RewardsServiceObserver : public base::CheckedObserver {
       const std::string& viewing_id,
       const double amount,
       const int32_t type) {}
+  virtual void OnBallotProofProgress(
+      RewardsService* rewards_service,
+      const uint32_t done,
+      const uint32_t total) {}
   virtual void OnAdsEnabled(
       brave_rewards::RewardsService* rewards_service,
       bool ads_enabled) {}
@@ -10,5 +10,9 @@ namespace switches {
 // Contains all flags that we use for rewards
 const char kRewards[] = "rewards";
 
+// Opts the rewards database into WAL journaling with tuned pragmas and a
+// separate read-only connection for UI queries
+const char kRewardsDatabaseTuning[] = "rewards-database-tuning";
+
 }  // namespace switches
 }  // namespace brave_rewards
@@ -26,11 +26,15 @@ const char kRewardsNotificationStartupDelay[] =
 const char kRewardsExternalWallets[] = "brave.rewards.external_wallets";
 const char kStateServerPublisherListStamp[] =
     "brave.rewards.server_publisher_list_stamp";
+const char kStateServerPublisherListETag[] =
+    "brave.rewards.server_publisher_list_etag";
 const char kStateUpholdAnonAddress[] =
     "brave.rewards.uphold_anon_address";
 const char kRewardsBadgeText[] = "brave.rewards.badge_text";
 const char kUseRewardsStagingServer[] = "brave.rewards.use_staging_server";
 const char kStatePromotionLastFetchStamp[] =
     "brave.rewards.promotion_last_fetch_stamp";
+const char kStateMediaPublisherCache[] =
+    "brave.rewards.media_publisher_cache";
 }  // namespace prefs
 }  // namespace brave_rewards
@@ -24,8 +24,10 @@ extern const char kRewardsBadgeText[];
 
 // Defined in native-ledger
 extern const char kStateServerPublisherListStamp[];
+extern const char kStateServerPublisherListETag[];
 extern const char kStateUpholdAnonAddress[];
 extern const char kStatePromotionLastFetchStamp[];
+extern const char kStateMediaPublisherCache[];
 
 extern const char kUseRewardsStagingServer[];
 }  // namespace prefs
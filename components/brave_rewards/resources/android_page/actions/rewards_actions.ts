@@ -63,8 +63,8 @@ export const onReconcileStamp = (stamp: number) => action(types.ON_RECONCILE_STA
   stamp
 })
 
-export const onContributeList = (list: Rewards.Publisher[]) => action(types.ON_CONTRIBUTE_LIST, {
-  list
+export const onContributeList = (page: Rewards.ContributeListPage) => action(types.ON_CONTRIBUTE_LIST, {
+  page
 })
 
 export const onExcludedList = (list: Rewards.ExcludedPublisher[]) => action(types.ON_EXCLUDED_LIST, {
@@ -114,6 +114,10 @@ export const getTipTable = () => action(types.GET_TIP_TABLE)
 
 export const getContributeList = () => action(types.GET_CONTRIBUTE_LIST)
 
+export const getContributeListPage = (cursor: Rewards.ContributeListCursor) => action(types.GET_CONTRIBUTE_LIST_PAGE, {
+  cursor
+})
+
 export const onInitAutoContributeSettings = (properties: any) => action(types.INIT_AUTOCONTRIBUTE_SETTINGS, {
   properties
 })
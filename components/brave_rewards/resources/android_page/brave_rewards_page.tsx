@@ -77,8 +77,8 @@ window.cr.define('brave_rewards', function () {
     getActions().onReconcileStamp(stamp)
   }
 
-  function contributeList (list: Rewards.Publisher[]) {
-    getActions().onContributeList(list)
+  function contributeList (page: Rewards.ContributeListPage) {
+    getActions().onContributeList(page)
   }
 
   function excludedList (list: Rewards.ExcludedPublisher[]) {
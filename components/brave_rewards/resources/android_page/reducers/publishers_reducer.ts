@@ -9,7 +9,12 @@ import { types } from '../constants/rewards_types'
 
 const publishersReducer: Reducer<Rewards.State | undefined> = (state: Rewards.State, action) => {
   switch (action.type) {
-    case types.ON_CONTRIBUTE_LIST:
+    case types.ON_CONTRIBUTE_LIST: {
+      const page: Rewards.ContributeListPage = action.payload.page
+      if (!page) {
+        break
+      }
+
       state = { ...state }
       if (state.contributeLoad) {
         state.firstLoad = false
@@ -17,8 +22,13 @@ const publishersReducer: Reducer<Rewards.State | undefined> = (state: Rewards.St
         state.contributeLoad = true
       }
 
-      state.autoContributeList = action.payload.list
+      state.autoContributeList = page.firstPage
+        ? page.list
+        : state.autoContributeList.concat(page.list)
+      state.autoContributeTotal = page.total
+      state.autoContributeNext = page.next
       break
+    }
     case types.ON_EXCLUDED_LIST: {
       if (!action.payload.list) {
         break
@@ -40,13 +40,24 @@ class ContributeBox extends React.Component<Props, State> {
     }
   }
 
-  componentDidUpdate (prevProps: Props) {
+  componentDidUpdate (prevProps: Props, prevState: State) {
     if (
       prevProps.rewardsData.enabledMain &&
       !this.props.rewardsData.enabledMain
     ) {
       this.setState({ settings: false })
     }
+
+    // The list comes in pages, the rest is only needed to show all sites
+    const { autoContributeNext } = this.props.rewardsData
+    if (
+      this.state.modalContribute &&
+      autoContributeNext &&
+      (!prevState.modalContribute ||
+        prevProps.rewardsData.autoContributeNext !== autoContributeNext)
+    ) {
+      this.actions.getContributeListPage(autoContributeNext)
+    }
   }
 
   getContributeRows = (list: Rewards.Publisher[]) => {
@@ -226,6 +237,7 @@ class ContributeBox extends React.Component<Props, State> {
       enabledContribute,
       reconcileStamp,
       autoContributeList,
+      autoContributeTotal,
       excludedList,
       balance,
       ui
@@ -234,7 +246,7 @@ class ContributeBox extends React.Component<Props, State> {
     const contributeRows = this.getContributeRows(autoContributeList)
     const excludedRows = this.getExcludedRows(excludedList)
     const topRows = contributeRows.slice(0, 5)
-    const numRows = contributeRows && contributeRows.length
+    const numRows = autoContributeTotal
     const numExcludedRows = excludedRows && excludedRows.length
     const allSites = !(excludedRows.length > 0 || numRows > 5)
     const showDisabled = firstLoad !== false || !enabledMain || !enabledContribute
@@ -38,6 +38,7 @@ export const enum types {
   ON_CURRENT_TIPS = '@@rewards/ON_CURRENT_TIPS',
   GET_TIP_TABLE = '@@rewards/GET_TIP_TABLE',
   GET_CONTRIBUTE_LIST = '@@rewards/GET_CONTRIBUTE_LIST',
+  GET_CONTRIBUTE_LIST_PAGE = '@@rewards/GET_CONTRIBUTE_LIST_PAGE',
   INIT_AUTOCONTRIBUTE_SETTINGS = '@@rewards/INIT_AUTOCONTRIBUTE_SETTINGS',
   CHECK_IMPORTED = '@@rewards/CHECK_IMPORTED',
   ON_IMPORTED_CHECK = '@@rewards/ON_IMPORTED_CHECK',
@@ -95,6 +95,18 @@ const rewardsReducer: Reducer<Rewards.State | undefined> = (state: Rewards.State
       chrome.send('brave_rewards.getContributionList')
       break
     }
+    case types.GET_CONTRIBUTE_LIST_PAGE: {
+      const cursor: Rewards.ContributeListCursor = action.payload.cursor
+      if (!cursor) {
+        break
+      }
+
+      chrome.send('brave_rewards.getContributionListPage', [
+        cursor.percentage,
+        cursor.publisherKey
+      ])
+      break
+    }
     case types.CHECK_IMPORTED: {
       chrome.send('brave_rewards.checkImported')
       break
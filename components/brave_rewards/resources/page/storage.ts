@@ -40,6 +40,7 @@ export const defaultState: Rewards.State = {
     onBoardingDisplayed: false
   },
   autoContributeList: [],
+  autoContributeTotal: 0,
   recurringList: [],
   tipsList: [],
   contributeLoad: false,
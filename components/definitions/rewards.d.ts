@@ -27,6 +27,8 @@ declare namespace Rewards {
     adsData: AdsData
     adsHistory: AdsHistory[]
     autoContributeList: Publisher[]
+    autoContributeNext?: ContributeListCursor
+    autoContributeTotal: number
     balance: Balance
     balanceReport?: BalanceReport
     contributeLoad: boolean
@@ -185,6 +187,18 @@ declare namespace Rewards {
     tipDate?: number
   }
 
+  export interface ContributeListCursor {
+    percentage: number
+    publisherKey: string
+  }
+
+  export interface ContributeListPage {
+    list: Publisher[]
+    total: number
+    firstPage: boolean
+    next?: ContributeListCursor
+  }
+
   export interface ExcludedPublisher {
     id: string
     status: PublisherStatus
@@ -3,6 +3,7 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <limits>
 #include <utility>
 #include <vector>
 
@@ -82,6 +83,12 @@ void BatAdsImpl::OnPageLoaded(
   ads_->OnPageLoaded(url, html);
 }
 
+void BatAdsImpl::ShouldClassifyPage(
+    const std::string& url,
+    ShouldClassifyPageCallback callback) {
+  std::move(callback).Run(ads_->ShouldClassifyPage(url));
+}
+
 void BatAdsImpl::ServeSampleAd() {
   ads_->ServeSampleAd();
 }
@@ -157,10 +164,12 @@ void BatAdsImpl::GetAdsHistory(
     const uint64_t from_timestamp,
     const uint64_t to_timestamp,
     GetAdsHistoryCallback callback) {
+  // The rewards page is not paginated, so it shows every entry in the date
+  // range
   ads::AdsHistory history = ads_->GetAdsHistory(
       ads::AdsHistory::FilterType::kConfirmationType,
           ads::AdsHistory::SortType::kDescendingOrder, from_timestamp,
-              to_timestamp);
+              to_timestamp, std::numeric_limits<uint64_t>::max());
 
   std::move(callback).Run(history.ToJson());
 }
@@ -48,6 +48,10 @@ class BatAdsImpl :
       const std::string& url,
       const std::string& html) override;
 
+  void ShouldClassifyPage(
+      const std::string& url,
+      ShouldClassifyPageCallback callback) override;
+
   void ServeSampleAd() override;
 
   void OnTimer(
@@ -148,6 +148,15 @@ void BatLedgerClientMojoProxy::OnReconcileComplete(
       type);
 }
 
+void BatLedgerClientMojoProxy::OnBallotProofProgress(
+    const uint32_t done,
+    const uint32_t total) {
+  if (!Connected())
+    return;
+
+  bat_ledger_client_->OnBallotProofProgress(done, total);
+}
+
 std::unique_ptr<ledger::LogStream> BatLedgerClientMojoProxy::Log(
     const char* file, int line, ledger::LogLevel level) const {
   // There's no need to proxy this
@@ -35,6 +35,8 @@ class BatLedgerClientMojoProxy : public ledger::LedgerClient,
                            const std::string& viewing_id,
                            const double amount,
                            const ledger::RewardsType type) override;
+  void OnBallotProofProgress(const uint32_t done,
+                             const uint32_t total) override;
   void LoadLedgerState(ledger::OnLoadCallback callback) override;
   void LoadPublisherState(ledger::OnLoadCallback callback) override;
   void SaveLedgerState(const std::string& ledger_state,
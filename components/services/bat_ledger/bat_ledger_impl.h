@@ -54,13 +54,7 @@ class BatLedgerImpl : public mojom::BatLedger,
   void OnForeground(uint32_t tab_id, uint64_t current_time) override;
   void OnBackground(uint32_t tab_id, uint64_t current_time) override;
 
-  void OnPostData(const std::string& url,
-      const std::string& first_party_url, const std::string& referrer,
-      const std::string& post_data, ledger::VisitDataPtr visit_data) override;
-  void OnXHRLoad(uint32_t tab_id, const std::string& url,
-      const base::flat_map<std::string, std::string>& parts,
-      const std::string& first_party_url, const std::string& referrer,
-      ledger::VisitDataPtr visit_data) override;
+  void OnMediaRequests(ledger::MediaRequestList requests) override;
 
   void SetPublisherExclude(
       const std::string& publisher_key,
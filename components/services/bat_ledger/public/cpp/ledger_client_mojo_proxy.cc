@@ -144,6 +144,12 @@ void LedgerClientMojoProxy::OnReconcileComplete(
       type);
 }
 
+void LedgerClientMojoProxy::OnBallotProofProgress(
+    const uint32_t done,
+    const uint32_t total) {
+  ledger_client_->OnBallotProofProgress(done, total);
+}
+
 // static
 void LedgerClientMojoProxy::OnSavePublisherInfo(
     CallbackHolder<SavePublisherInfoCallback>* holder,
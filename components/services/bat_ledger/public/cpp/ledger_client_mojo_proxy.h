@@ -35,6 +35,9 @@ class LedgerClientMojoProxy : public mojom::BatLedgerClient,
       const std::string& viewing_id,
       const double amount,
       const ledger::RewardsType type) override;
+  void OnBallotProofProgress(
+      const uint32_t done,
+      const uint32_t total) override;
 
   void LoadPublisherState(LoadPublisherStateCallback callback) override;
   void SaveLedgerState(const std::string& ledger_state,
@@ -8,6 +8,89 @@ import { types } from '../../../../brave_rewards/resources/page/constants/reward
 import { defaultState } from '../../../../brave_rewards/resources/page/storage'
 
 describe('publishers reducer', () => {
+  describe('ON_CONTRIBUTE_LIST', () => {
+    const publisher = (id: string, percentage: number) => ({
+      publisherKey: id,
+      percentage,
+      status: 0,
+      excluded: 0,
+      url: `https://${id}`,
+      name: id,
+      provider: '',
+      favIcon: '',
+      id
+    })
+
+    it('replaces list on first page', () => {
+      const initialState = { ...defaultState }
+      initialState.autoContributeList = [publisher('bar.com', 60)]
+
+      const assertion = reducers({ rewardsData: initialState }, {
+        type: types.ON_CONTRIBUTE_LIST,
+        payload: {
+          page: {
+            list: [publisher('foo.com', 70)],
+            total: 2,
+            firstPage: true,
+            next: {
+              percentage: 70,
+              publisherKey: 'foo.com'
+            }
+          }
+        }
+      })
+
+      const expectedState: Rewards.State = { ...defaultState }
+      expectedState.contributeLoad = true
+      expectedState.autoContributeList = [publisher('foo.com', 70)]
+      expectedState.autoContributeTotal = 2
+      expectedState.autoContributeNext = {
+        percentage: 70,
+        publisherKey: 'foo.com'
+      }
+
+      expect(assertion).toEqual({
+        rewardsData: expectedState
+      })
+    })
+
+    it('appends next page', () => {
+      const initialState = { ...defaultState }
+      initialState.contributeLoad = true
+      initialState.autoContributeList = [publisher('foo.com', 70)]
+      initialState.autoContributeTotal = 2
+      initialState.autoContributeNext = {
+        percentage: 70,
+        publisherKey: 'foo.com'
+      }
+
+      const assertion = reducers({ rewardsData: initialState }, {
+        type: types.ON_CONTRIBUTE_LIST,
+        payload: {
+          page: {
+            list: [publisher('bar.com', 30)],
+            total: 2,
+            firstPage: false
+          }
+        }
+      })
+
+      const expectedState: Rewards.State = { ...defaultState }
+      expectedState.contributeLoad = true
+      expectedState.firstLoad = false
+      expectedState.autoContributeList = [
+        publisher('foo.com', 70),
+        publisher('bar.com', 30)
+      ]
+      expectedState.autoContributeTotal = 2
+      expectedState.autoContributeNext = undefined
+
+      expect(assertion).toEqual({
+        rewardsData: expectedState
+      })
+    })
+  })
+
   describe('ON_EXCLUDED_LIST', () => {
     it('updates list', () => {
       const assertion = reducers(undefined, {